@@ -21,14 +21,18 @@
  **/
 
 #include "./abort.hpp"
-#include "./fake_mutex.h"
-cilkscreen::fake_mutex abort_mutex;
-Abort::Abort() : aborted(false), parent() {
+
+#ifdef STATS
+cilk::reducer_opadd<unsigned int> abort_count;
+cilk::reducer_opadd<unsigned int> poll_count;
+#endif
+
+Abort::Abort() : parent(), aborted(false) {
   pollGranularity = 1;
   count = 0;
 }
 
-Abort::Abort(Abort *p) : aborted(false), parent(p) {
+Abort::Abort(Abort *p) : parent(p), aborted(false) {
     pollGranularity = 1;
     count = 0;
 }
@@ -36,28 +40,18 @@ void Abort::setGranularity(int newGranularity) {
     pollGranularity = newGranularity;
 }
 
-int Abort::isAborted() {
-  abort_mutex.lock();
-  // allows for polling every i'th call
-  if (count >= pollGranularity - 1) {
-    count = 0;
-  } else {
-    count++;
-    abort_mutex.unlock();
-    return 0;
-  }
-  bool ret = aborted || (parent && this->parent->isAborted());
-  abort_mutex.unlock();
-  return ret;
-}
-
 void Abort::abort() {
-  abort_mutex.lock();
   #ifdef STATS
   if (!aborted) {
     abort_count += 1;
   }
   #endif
   aborted = true;
-  abort_mutex.unlock();
+}
+
+// Clears the flag, for reusing a root token between searches.  Must not be
+// called while any descendant is still polling.
+void Abort::reset() {
+  aborted = false;
+  count = 0;
 }
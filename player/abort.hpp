@@ -28,8 +28,8 @@
 #include <cilk/cilk.h>
 #include <cilk/reducer_opadd.h>
 
-cilk::reducer_opadd<unsigned int> abort_count;
-cilk::reducer_opadd<unsigned int> poll_count;
+extern cilk::reducer_opadd<unsigned int> abort_count;
+extern cilk::reducer_opadd<unsigned int> poll_count;
 
 #endif
 
@@ -59,6 +59,10 @@ cilk::reducer_opadd<unsigned int> poll_count;
 // to see if they should end. O(h) in height of tree of spawned computations
 // abort() sets a local flag to signify termination. Does nothing to children O(1)
 //
+// No locks are taken: a flag only ever goes from false to true, so a poll that
+// races with abort() at worst notices the abort one poll later.  A child that
+// finds an aborted ancestor sets its own flag, so later polls stop at the child.
+//
 // While other approaches to doing polling exist, see attached paper for analysis
 // of tradeoffs
 //
@@ -73,12 +77,34 @@ class Abort {
     Abort();
     explicit Abort(Abort *p);
     void setGranularity(int newGranularity);
-    int isAborted();
     void abort();
+    void reset();
+
+    // Called at every search node, so it lives in the header to be inlined.
+    inline int isAborted() {
+      #ifdef STATS
+      poll_count += 1;
+      #endif
+      if (aborted) {
+        return 1;
+      }
+      // allows for polling the ancestors every i'th call
+      if (pollGranularity > 1) {
+        if (++count < pollGranularity) {
+          return 0;
+        }
+        count = 0;
+      }
+      if (parent && parent->isAborted()) {
+        aborted = true;
+        return 1;
+      }
+      return 0;
+    }
 
   private:
     Abort *parent;
-    bool aborted;
+    volatile bool aborted;
     int pollGranularity;
     int count;
 };
@@ -24,7 +24,9 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include "eval.h"
+#include "stats.h"
 
 //----------------------------------------------------------------------
 // Evaluation
@@ -126,13 +128,12 @@ ev_score_t kface_old(position_t *p, fil_t f, rnk_t r) {
 }
 
 // KAGGRESSIVE heuristic: bonus for King with more space to back
+// The kings may share a file or rank, which kaggressive_old settles by the
+// first of its cases that matches.
 inline ev_score_t kaggressive(fil_t f, rnk_t r, fil_t otherf, rnk_t otherr) {
-
-  assert(f != otherf);
-  assert(r != otherr);
   int bonus = 0;
 
-  if (otherf >= f) {   // delta_fil >= 0 is equivalent to otherf >= f
+  if (otherf > f || (otherf == f && otherr >= r)) {
     bonus = f + 1;
   } else {
     bonus = BOARD_WIDTH - f;
@@ -386,46 +387,101 @@ void mark_laser_path(position_t *p, bool * laser_map, color_t c) {
 //   return attackable;
 // }
 
-int h_squares_attackable(position_t *p, color_t c) {
-  float h_attackable = 0;
-  square_t o_king_sq = p->king_locs[opp_color(c)];
-
-  // Fire laser, recording in laser_map
-  square_t sq = p->king_locs[c];
-  int bdir = orientation_of(p->board[sq]);
-  int beam = beam_of(bdir);
-  assert(ptype_of(p->board[sq]) == KING);
-  h_attackable += h_dist(sq, o_king_sq);  
+#define H_INV_ENTRY(a, d) ((d) < BOARD_WIDTH ? H_SCALE / ((d) + 1) : 0)
+
+const int16_t h_inv[H_TABLE_SIZE] CACHE_LINE_ALIGNMENT = {
+  TABLE_REP16(H_INV_ENTRY, 0, 0)
+};
+
+// h_line[k][i]: the sum of h_inv[|x - k|] over 0 <= x < i
+#define H_LINE_TERM(k, i, x) \
+  ((x) < (i) ? H_INV_ENTRY(0, (x) > (k) ? (x) - (k) : (k) - (x)) : 0)
+#define H_LINE_ENTRY(k, i)                                                \
+  (H_LINE_TERM(k, i, 0) + H_LINE_TERM(k, i, 1) + H_LINE_TERM(k, i, 2) +    \
+   H_LINE_TERM(k, i, 3) + H_LINE_TERM(k, i, 4) + H_LINE_TERM(k, i, 5) +    \
+   H_LINE_TERM(k, i, 6) + H_LINE_TERM(k, i, 7) + H_LINE_TERM(k, i, 8) +    \
+   H_LINE_TERM(k, i, 9) + H_LINE_TERM(k, i, 10) + H_LINE_TERM(k, i, 11) +  \
+   H_LINE_TERM(k, i, 12) + H_LINE_TERM(k, i, 13) + H_LINE_TERM(k, i, 14))
+#define H_LINE_ROW(a, k) { TABLE_REP16(H_LINE_ENTRY, k, 0) }
+typedef char board_fits_h_tables[BOARD_WIDTH < H_TABLE_SIZE ? 1 : -1];
+
+static const int16_t h_line[H_TABLE_SIZE][H_TABLE_SIZE] CACHE_LINE_ALIGNMENT = {
+  TABLE_ROWS16(H_LINE_ROW, 0, 0)
+};
+
+// H_SCALE * h_dist to the king over the squares x in [lo, hi) of a line
+// that is d files (or ranks) away from it, where k is the king's
+// coordinate along the line
+static inline int h_run(int lo, int hi, int k, int d) {
+  return (hi - lo) * h_inv[abs(d)] + h_line[k][hi] - h_line[k][lo];
+}
 
-  while (true) {
-    assert(beam == beam_of(bdir));
-    sq += beam;
-    assert(sq < ARR_SIZE && sq >= 0);
-    
-    switch (ptype_of(p->board[sq])) {
-      case EMPTY:  // empty square
-        h_attackable += h_dist(sq, o_king_sq);  
+// sums h_dist to the other king over the squares c's laser lights
+static int trace_h_attackable(position_t *p, color_t c) {
+  square_t o_king_sq = p->king_locs[opp_color(c)];
+  fil_t kf = fil_of(o_king_sq);
+  rnk_t kr = rnk_of(o_king_sq);
+  laser_path_t path;
+  trace_laser(p, c, &path);
+
+  // the king's own square, then every square each segment lights.  A
+  // segment stays on one file or rank, so it sums in constant time.
+  int h_attackable = h_dist(path.from[0], o_king_sq);
+  for (int i = 0; i < path.count; i++) {
+    square_t from = path.from[i];
+    square_t to = path.to[i];
+    switch (path.dir[i]) {
+      case NN:
+        h_attackable += h_run(rnk_of(from) + 1, rnk_of(to) + 1, kr, fil_of(from) - kf);
         break;
-      case PAWN:  // Pawn
-        h_attackable += h_dist(sq, o_king_sq);  
-        bdir = reflect_of(bdir, orientation_of(p->board[sq]));
-        if (bdir < 0) {  // Hit back of Pawn
-          return h_attackable;
-        }
-        beam = beam_of(bdir);
+      case SS:
+        h_attackable += h_run(rnk_of(to), rnk_of(from), kr, fil_of(from) - kf);
         break;
-      case KING:  // King
-        h_attackable += h_dist(sq, o_king_sq);  
-        return h_attackable;  // sorry, game over my friend!
+      case EE:
+        h_attackable += h_run(fil_of(from) + 1, fil_of(to) + 1, kf, rnk_of(from) - kr);
         break;
-      case INVALID:  // Ran off edge of board
-        return h_attackable;
+      case WW:
+        h_attackable += h_run(fil_of(to), fil_of(from), kf, rnk_of(from) - kr);
         break;
-      default:  // Shouldna happen, man!
+      default:
         assert(false);
-        break;
     }
   }
+  return h_attackable / H_SCALE;
+}
+
+// The segment walk trace_h_attackable replaced, for parity: h_dist_old to
+// the other king over the king's own square and every square each segment
+// lights, so a square the laser crosses twice counts twice.  The sum is
+// kept in double, and rounded to whole units of 1/H_SCALE before it is
+// truncated, since the float walk truncated a whole-number sum that had
+// drifted a few ulps low to one less.
+static int h_squares_attackable_float(position_t *p, color_t c) {
+  square_t o_king_sq = p->king_locs[opp_color(c)];
+  laser_path_t path;
+  trace_laser(p, c, &path);
+
+  double h_attackable = h_dist_old(path.from[0], o_king_sq);
+  for (int i = 0; i < path.count; i++) {
+    int beam = beam_of(path.dir[i]);
+    for (square_t sq = path.from[i]; sq != path.to[i]; ) {
+      sq += beam;
+      h_attackable += h_dist_old(sq, o_king_sq);
+    }
+  }
+  return (int) floor(h_attackable * H_SCALE + 0.5) / H_SCALE;
+}
+
+int h_squares_attackable(position_t *p, color_t c) {
+  laser_cache_t *lc = &p->laser[c];
+  if (lc->h_key == p->key) {
+    assert(lc->h_attackable == trace_h_attackable(p, c));
+    return lc->h_attackable;
+  }
+  lc->h_attackable = trace_h_attackable(p, c);
+  lc->h_key = p->key;
+  assert(lc->h_attackable == h_squares_attackable_float(p, c));
+  return lc->h_attackable;
 }
 
 int h_squares_attackable_old(position_t *p, color_t c) {
@@ -445,7 +501,7 @@ int h_squares_attackable_old(position_t *p, color_t c) {
     for (rnk_t r = 0; r < BOARD_WIDTH; r++) {
       square_t sq = square_of(f, r);
       if (laser_map[sq]) {
-          h_attackable += h_dist(sq, o_king_sq);
+          h_attackable += h_dist_old(sq, o_king_sq);
       }
     }
   }
@@ -454,9 +510,9 @@ int h_squares_attackable_old(position_t *p, color_t c) {
 
 int h_squares_attackable_test(position_t *p, color_t c) {
   int hnew = h_squares_attackable(p, c);
-  int hold = h_squares_attackable_old(p, c);
+  int hold = h_squares_attackable_float(p, c);
   if (hnew != hold) {
-    std::cout<<"\nh_squares_attackable_old: "<<hold<<". h_squares_attackable_new: "<<hnew;
+    std::cout<<"\nh_squares_attackable_float: "<<hold<<". h_squares_attackable_new: "<<hnew;
   }
   return hnew;
 }
@@ -546,13 +602,9 @@ score_t unoptimized_eval(position_t *p, bool verbose) {
   return tot / EV_SCORE_RATIO;
 }
 
-// Static evaluation.  Returns score
-score_t eval(position_t *p, bool verbose) {
-  ev_score_t score[2] = { 0, 0 };
-  //  int corner[2][2] = { {INF, INF}, {INF, INF} };
+// Adds to score[] every term but HATTACK, which needs the lasers traced.
+static inline void eval_cheap_terms(position_t *p, ev_score_t score[2]) {
   ev_score_t bonus;
-  char buf[MAX_CHARS_IN_MOVE];
-  bool is_between;
   fil_t king_fil[2] = { fil_of(p->king_locs[0]), fil_of(p->king_locs[1]) }; // respects ordering of WHITE and BLACK
   rnk_t king_rnk[2] = { rnk_of(p->king_locs[0]), rnk_of(p->king_locs[1]) }; // respects ordering of WHITE and BLACK
 
@@ -571,36 +623,14 @@ score_t eval(position_t *p, bool verbose) {
   assert(bonus == kaggressive_old(p, king_fil[WHITE], king_rnk[WHITE]));
   score[WHITE] += bonus;
 
-  if (king_rnk[0] > king_rnk[1]) { // sort king_rnk. won't respect ordering of WHITE and BLACK anymore
-    rnk_t tmp = king_rnk[0];
-    king_rnk[0] = king_rnk[1];
-    king_rnk[1] = tmp;
-  }
-  if (king_fil[0] > king_fil[1]) { // sort king_fil. won't respect ordering of WHITE and BLACK anymore
-    fil_t tmp = king_fil[0];
-    king_fil[0] = king_fil[1];
-    king_fil[1] = tmp;
-  }
-  int i;
-  square_t sq;
-  for (int c = 0; c < 2; c++) { // consider unrolling this loop or using pointer access
-    i = 0;
-    while (sq = p->pawns_locs[c][i]) {
-      // MATERIAL heuristic: Bonus for each Pawn
-      bonus = PAWN_EV_VALUE;
-      score[c] += bonus;
-      // PBETWEEN heuristic
-      if (betweenrange(fil_of(sq), king_fil[0], king_fil[1]) && 
-          betweenrange(rnk_of(sq), king_rnk[0], king_rnk[1])) {
-        bonus = PBETWEEN;
-        score[c] += bonus;
-        // PMIRROR penalty
-        //score[c] += pmirror(p, sq);
-      }
-      i++;
-    }
+  // pawn counts are kept up to date by make_move
+  for (int c = 0; c < 2; c++) {
+    // MATERIAL heuristic: Bonus for each Pawn
+    score[c] += PAWN_EV_VALUE * p->pawn_count[c];
+    // PBETWEEN heuristic
+    score[c] += PBETWEEN * p->pawns_between[c];
   }
-  
+
   // Make sure that the squares in the pawns_locs are unique.
   // for (int i = 0; i < 2 * PAWNS_COUNT; i++) {
   //   square_t sq = *(*(p->pawns_locs) + i);
@@ -611,6 +641,112 @@ score_t eval(position_t *p, bool verbose) {
   //     }
   //   }
   // }
+}
+
+#ifndef NDEBUG
+// Checks eval_children_cheap's delta for mv by making the move.  Children
+// whose laser zaps something are left out, since it counts the child
+// before the zap.
+static bool eval_child_cheap_agrees(position_t *p, move_t mv, int delta) {
+  position_t np = *p;
+  undo_t undo;
+  if (make_move(&np, mv, &undo) != 0) {
+    return true;  // a zap, or KO
+  }
+  color_t ctm = color_to_move_of(p);
+  ev_score_t before[2] = { 0, 0 };
+  ev_score_t after[2] = { 0, 0 };
+  eval_cheap_terms(p, before);
+  eval_cheap_terms(&np, after);
+  return delta == (after[ctm] - after[opp_color(ctm)]) -
+                  (before[ctm] - before[opp_color(ctm)]);
+}
+#endif
+
+// Changes in the cheap terms (material, PBETWEEN, KFACE and KAGGRESSIVE)
+// from p to the child each of moves[0..n) leads to, before the child's
+// laser fires, from the mover's point of view.  A move that leaves the
+// kings alone only carries a pawn or two across the kings' rectangle, so
+// it costs a few compares; only king moves rescore the king terms.
+void eval_children_cheap(position_t *p, sortable_move_t *moves, int n,
+                         int *delta) {
+  color_t ctm = color_to_move_of(p);
+  color_t opp = opp_color(ctm);
+  ev_score_t base[2] = { 0, 0 };
+  eval_cheap_terms(p, base);
+  square_t k[2] = { p->king_locs[WHITE], p->king_locs[BLACK] };
+
+  for (int i = 0; i < n; i++) {
+    move_t mv = get_move(moves[i]);
+    square_t fs = from_square(mv);
+    square_t ts = to_square(mv);
+    piece_t fp = p->board[fs];
+    piece_t tp = p->board[ts];
+    assert(color_of(fp) == ctm);
+
+    if (ptype_of(fp) != KING && ptype_of(tp) != KING) {
+      // fp goes to ts, and a pawn on ts comes back to fs.  An enemy pawn
+      // going the other way doubles the change, and one of our own
+      // cancels it.
+      int d = (between(fil_of(ts), fil_of(k[0]), fil_of(k[1])) &&
+               between(rnk_of(ts), rnk_of(k[0]), rnk_of(k[1]))) -
+              (between(fil_of(fs), fil_of(k[0]), fil_of(k[1])) &&
+               between(rnk_of(fs), rnk_of(k[0]), rnk_of(k[1])));
+      if (ptype_of(tp) == PAWN) {
+        d = color_of(tp) == ctm ? 0 : 2 * d;
+      }
+      delta[i] = PBETWEEN * d;
+      continue;
+    }
+
+    square_t loc[2] = { k[0], k[1] };
+    piece_t king[2] = { p->board[k[0]], p->board[k[1]] };
+    if (fs == ts) {
+      set_ori(&king[ctm], rot_of(mv) + orientation_of(fp));
+    } else {
+      if (ptype_of(fp) == KING) {
+        loc[color_of(fp)] = ts;
+      }
+      if (ptype_of(tp) == KING) {
+        loc[color_of(tp)] = fs;
+      }
+    }
+
+    int pawns_between[2];
+    count_pawns_between(p, loc[WHITE], loc[BLACK], pawns_between);
+    // a pawn swapped with a king was counted on the square it left
+    if (fs != ts && (ptype_of(fp) == PAWN || ptype_of(tp) == PAWN)) {
+      square_t from = ptype_of(fp) == PAWN ? fs : ts;
+      square_t to = ptype_of(fp) == PAWN ? ts : fs;
+      color_t c = color_of(p->board[from]);
+      pawns_between[c] +=
+          (between(fil_of(to), fil_of(loc[0]), fil_of(loc[1])) &&
+           between(rnk_of(to), rnk_of(loc[0]), rnk_of(loc[1]))) -
+          (between(fil_of(from), fil_of(loc[0]), fil_of(loc[1])) &&
+           between(rnk_of(from), rnk_of(loc[0]), rnk_of(loc[1])));
+    }
+
+    ev_score_t score[2];
+    for (int c = 0; c < 2; c++) {
+      fil_t f = fil_of(loc[c]), of = fil_of(loc[1 - c]);
+      rnk_t r = rnk_of(loc[c]), _or = rnk_of(loc[1 - c]);
+      score[c] = kface(king[c], f, r, of, _or) + kaggressive(f, r, of, _or) +
+                 PAWN_EV_VALUE * p->pawn_count[c] + PBETWEEN * pawns_between[c];
+    }
+    delta[i] = (score[ctm] - score[opp]) - (base[ctm] - base[opp]);
+  }
+
+#ifndef NDEBUG
+  for (int i = 0; i < n; i++) {
+    assert(eval_child_cheap_agrees(p, get_move(moves[i]), delta[i]));
+  }
+#endif
+}
+
+// Static evaluation.  Returns score
+score_t eval(position_t *p, bool verbose) {
+  ev_score_t score[2] = { 0, 0 };
+  eval_cheap_terms(p, score);
 
   ev_score_t w_hattackable = HATTACK * h_squares_attackable(p, WHITE);
   score[WHITE] += w_hattackable;
@@ -632,3 +768,154 @@ score_t eval(position_t *p, bool verbose) {
   assert(unoptimized_eval(p, verbose) == tot / EV_SCORE_RATIO);
   return tot / EV_SCORE_RATIO;
 }
+
+//----------------------------------------------------------------------
+// Eval cache
+
+// A direct-mapped table of eval() results, apart from the transposition
+// table so that stand-pat scores do not evict search results.  An entry
+// is one 64-bit word, the top bits of the key above the score, so threads
+// share the table without locking as they do the transposition table.
+
+int EVAL_CACHE;  // eval cache size in KBytes, 0 for none
+
+#define EVC_SCORE_MASK 0xFFFF
+#define EVC_KEY_MASK   (~(uint64_t) EVC_SCORE_MASK)
+
+static uint64_t *evc_table = NULL;
+static uint64_t evc_mask;        // number of entries - 1
+
+// Counted without synchronization, so only approximate with several
+// search threads.
+static uint64_t evc_probes;
+static uint64_t evc_hits;
+
+void eval_cache_resize(int size_in_kb) {
+  free(evc_table);
+  evc_table = NULL;
+  if (size_in_kb == 0) {
+    return;
+  }
+  uint64_t entries = 1;
+  while (entries * 2 * sizeof(uint64_t) <= (uint64_t) size_in_kb * 1024) {
+    entries *= 2;
+  }
+  if (posix_memalign((void **) &evc_table, 64, entries * sizeof(uint64_t))) {
+    fprintf(stderr, "Can't allocate %d KB for the eval cache\n", size_in_kb);
+    evc_table = NULL;
+    return;
+  }
+  evc_mask = entries - 1;
+  eval_cache_clear();
+}
+
+void eval_cache_clear() {
+  if (evc_table) {
+    memset(evc_table, 0, (evc_mask + 1) * sizeof(uint64_t));
+  }
+}
+
+void eval_cache_stats(uint64_t *hits, uint64_t *probes) {
+  *hits = evc_hits;
+  *probes = evc_probes;
+}
+
+// looks p up in the cache, setting *score on a hit
+static inline bool evc_probe(position_t *p, score_t *score) {
+  uint64_t entry = evc_table[p->key & evc_mask];
+  evc_probes++;
+  if ((entry & EVC_KEY_MASK) != (p->key & EVC_KEY_MASK)) {
+    return false;
+  }
+  evc_hits++;
+  *score = (score_t) (entry & EVC_SCORE_MASK);
+  assert(*score == eval(p, false));
+  return true;
+}
+
+static inline void evc_store(position_t *p, score_t score) {
+  volatile uint64_t *slot = &evc_table[p->key & evc_mask];
+  *slot = (p->key & EVC_KEY_MASK) | (uint16_t) score;
+}
+
+// eval(p, false), from the cache if p has been evaluated before
+score_t eval_cached(position_t *p) {
+  STAT_INC(stat_evals);
+  if (evc_table == NULL || RANDOMIZE) {
+    STAT_INC(stat_full_evals);
+    return eval(p, false);
+  }
+  score_t score;
+  if (evc_probe(p, &score)) {
+    return score;
+  }
+  STAT_INC(stat_full_evals);
+  score = eval(p, false);
+  evc_store(p, score);
+  return score;
+}
+
+// h_attackable_max[k]: a bound on h_squares_attackable() against a king on
+// k.  A laser cannot cross a square twice along the same line, so it
+// lights each square at most twice, once along its file and once along
+// its rank.
+static int h_attackable_max[ARR_SIZE];
+
+void init_eval() {
+  for (fil_t kf = 0; kf < BOARD_WIDTH; kf++) {
+    for (rnk_t kr = 0; kr < BOARD_WIDTH; kr++) {
+      square_t k = square_of(kf, kr);
+      int sum = 0;
+      for (fil_t f = 0; f < BOARD_WIDTH; f++) {
+        for (rnk_t r = 0; r < BOARD_WIDTH; r++) {
+          sum += 2 * h_dist(square_of(f, r), k);
+        }
+      }
+      h_attackable_max[k] = sum / H_SCALE;
+    }
+  }
+}
+
+// Lazy eval for stand-pat tests.  Returns eval(p, false) when it lies
+// strictly between alpha and beta.  Otherwise it may return a bound on the
+// same side of the window: at least beta but no more than the score, or
+// at most alpha but no less.  The lasers are traced only when the other
+// terms together with the range of HATTACK leave the score inside the
+// window.
+score_t eval_bounded(position_t *p, int alpha, int beta) {
+  STAT_INC(stat_evals);
+  if (RANDOMIZE) {
+    STAT_INC(stat_full_evals);
+    return eval(p, false);
+  }
+  score_t score;
+  if (evc_table && evc_probe(p, &score)) {
+    return score;
+  }
+
+  ev_score_t cheap[2] = { 0, 0 };
+  eval_cheap_terms(p, cheap);
+  color_t ctm = color_to_move_of(p);
+  color_t opp = opp_color(ctm);
+  ev_score_t tot = cheap[ctm] - cheap[opp];
+  // our laser adds HATTACK * [0, max against their king], theirs takes off
+  // HATTACK * [0, max against ours]
+  ev_score_t lo = tot - HATTACK * h_attackable_max[p->king_locs[ctm]];
+  ev_score_t hi = tot + HATTACK * h_attackable_max[p->king_locs[opp]];
+  if (lo / EV_SCORE_RATIO >= beta) {
+    return lo / EV_SCORE_RATIO;
+  }
+  if (hi / EV_SCORE_RATIO <= alpha) {
+    return hi / EV_SCORE_RATIO;
+  }
+
+  STAT_INC(stat_full_evals);
+  tot += HATTACK * h_squares_attackable(p, ctm);
+  tot -= HATTACK * h_squares_attackable(p, opp);
+  score = tot / EV_SCORE_RATIO;
+  assert(score == eval(p, false));
+  if (evc_table) {
+    evc_store(p, score);
+  }
+  return score;
+}
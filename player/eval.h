@@ -23,10 +23,11 @@
 #ifndef EVAL_H
 #define EVAL_H
 
+#include <math.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "./search.h"
-#include "./hdist_table.c"
 
 #define EV_SCORE_RATIO 100   // Ratio of ev_score_t values to score_t values
 
@@ -44,10 +45,36 @@ inline float h_dist_old(square_t a, square_t b) {
   return x;
 }
 
-inline float h_dist(square_t a, square_t b) {
-  assert(((h_dist_old(a, b) + .001) >= hdist_table[a][b]) && (hdist_table[a][b] >= (h_dist_old(a, b)- .001)));
-  return hdist_table[a][b];
+// h_dist is kept in fixed point, in units of 1/H_SCALE.  H_SCALE is
+// lcm(1, ..., BOARD_WIDTH), so every 1/(d+1) is a whole number of units
+// and sums of h_dist are exact.
+#define H_SCALE 2520
+
+// h_inv[d] = H_SCALE / (d + 1), for d < BOARD_WIDTH <= H_TABLE_SIZE.
+// h_dist only depends on |dx| and |dy|, so
+// one row of BOARD_WIDTH entries covers every pair of squares.
+#define H_TABLE_SIZE 16
+extern const int16_t h_inv[H_TABLE_SIZE];
+
+// H_SCALE * h_dist_old(a, b), exactly
+inline int h_dist(square_t a, square_t b) {
+  int x = h_inv[abs(fil_of(a) - fil_of(b))] + h_inv[abs(rnk_of(a) - rnk_of(b))];
+  assert(fabs(x - H_SCALE * h_dist_old(a, b)) < .001 * H_SCALE);
+  return x;
 }
 
 score_t eval(position_t *p, bool verbose);
+score_t eval_cached(position_t *p);
+score_t eval_bounded(position_t *p, int alpha, int beta);
+void eval_children_cheap(position_t *p, sortable_move_t *moves, int n,
+                         int *delta);
+void init_eval();
+void eval_cache_resize(int size_in_kb);
+void eval_cache_clear();
+void eval_cache_stats(uint64_t *hits, uint64_t *probes);
+int h_squares_attackable(position_t *p, color_t c);
+
+// reference versions the ones above replaced, for testing and kbench
+score_t unoptimized_eval(position_t *p, bool verbose);
+int h_squares_attackable_old(position_t *p, color_t c);
 #endif  // EVAL_H
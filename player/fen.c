@@ -328,7 +328,7 @@ static int get_sq_from_str(char *fen, int *c_count, int *sq) {
 
 // Set up position
 int fen_to_pos(position_t *p, char *fen) {
-  static  position_t dmy1, dmy2;
+  static  undo_t dmy1, dmy2;
 
   // these sentinels simplify checking previous
   // states without stepping past null pointers.
@@ -361,6 +361,18 @@ int fen_to_pos(position_t *p, char *fen) {
     return 1;  // parse error of board
   }
 
+  // nothing is known of the lasers yet
+  for (int c = 0; c < 2; c++) {
+    p->laser[c].key = 0;
+    p->laser[c].h_key = 0;
+  }
+
+#ifdef BITBOARD
+  p->occupied = 0;
+  p->color_bb[WHITE] = 0;
+  p->color_bb[BLACK] = 0;
+  p->pawn_bb = 0;
+#else
   // Reset pawns
   for (int i = 0; i < PAWNS_COUNT + 1; i++) {
     p->pawns_locs[0][i] = 0;
@@ -371,10 +383,13 @@ int fen_to_pos(position_t *p, char *fen) {
     p->bit_ranks[i] = 0;
     p->bit_files[i] = 0;
   }
+#endif
 
   // King check
   int Kings[2] = {0, 0};
+#ifndef BITBOARD
   int pawns_counter[2] = {0, 0};
+#endif
   for (fil_t f = 0; f < BOARD_WIDTH; ++f) {
     for (rnk_t r = 0; r < BOARD_WIDTH; ++r) {
       square_t sq = square_of(f, r);
@@ -383,16 +398,26 @@ int fen_to_pos(position_t *p, char *fen) {
       if (typ == KING) {
         Kings[color_of(x)]++;
         p->king_locs[color_of(x)] = sq;
+#ifdef BITBOARD
+        bb_toggle(p, sq, x);
+#else
         set_bit(p, f, r);
+#endif
       } else if (typ == PAWN) {
+#ifdef BITBOARD
+        bb_toggle(p, sq, x);
+#else
         p->pawns_locs[color_of(x)][pawns_counter[color_of(x)]] = sq;
         pawns_counter[color_of(x)]++;
         set_bit(p, f, r);
+#endif
       }
     }
   }
+#ifndef BITBOARD
   std::stable_partition(p->pawns_locs[BLACK], p->pawns_locs[BLACK] + PAWNS_COUNT, is_greater_than_zero);  
   std::stable_partition(p->pawns_locs[WHITE], p->pawns_locs[WHITE] + PAWNS_COUNT, is_greater_than_zero);  
+#endif
   if (Kings[WHITE] == 0) {
     fen_error(fen, c_count, "No White Kings");
     return 1;
@@ -406,6 +431,7 @@ int fen_to_pos(position_t *p, char *fen) {
     fen_error(fen, c_count, "Too many Black Kings");
     return 1;
   }
+  count_pawns(p);
 
   char c;
   bool done = false;
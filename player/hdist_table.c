@@ -1,146 +0,0 @@
-const float hdist_table[144][144] = {
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 1.1, 0.181818, 0.181818, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.181818, 0.181818, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.181818, 0.181818, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.35, 0.181818, 0.181818, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.3, 0.181818, 0.181818, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.181818, 0.181818, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.181818, 0.181818, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.236111, 0.225, 0.181818, 0.181818, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.181818, 0.181818, 1.1, 0.6, 0.433333, 0.35, 0.3, 0.266667, 0.242857, 0.225, 0.211111, 0.2, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, 0.181818, }, 
-{0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 0.190909, 0.190909, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.190909, 0.190909, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.190909, 0.190909, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.190909, 0.190909, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.190909, 0.190909, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.190909, 0.190909, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.190909, 0.190909, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.236111, 0.190909, 0.190909, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.190909, 0.190909, 0.6, 1.1, 0.6, 0.433333, 0.35, 0.3, 0.266667, 0.242857, 0.225, 0.211111, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, }, 
-{0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 0.20202, 0.20202, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.20202, 0.20202, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.20202, 0.20202, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.20202, 0.20202, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.20202, 0.20202, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.20202, 0.20202, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.20202, 0.20202, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.20202, 0.20202, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.20202, 0.20202, 0.433333, 0.6, 1.1, 0.6, 0.433333, 0.35, 0.3, 0.266667, 0.242857, 0.225, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, }, 
-{0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 0.215909, 0.215909, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.215909, 0.215909, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.215909, 0.215909, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.215909, 0.215909, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.215909, 0.215909, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.215909, 0.215909, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.215909, 0.215909, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.215909, 0.215909, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.215909, 0.215909, 0.35, 0.433333, 0.6, 1.1, 0.6, 0.433333, 0.35, 0.3, 0.266667, 0.242857, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, }, 
-{0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 0.233766, 0.233766, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.233766, 0.233766, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.233766, 0.233766, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.233766, 0.233766, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.233766, 0.233766, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.233766, 0.233766, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.233766, 0.233766, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.233766, 0.233766, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.233766, 0.233766, 0.3, 0.35, 0.433333, 0.6, 1.1, 0.6, 0.433333, 0.35, 0.3, 0.266667, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, }, 
-{0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 0.257576, 0.257576, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.257576, 0.257576, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.257576, 0.257576, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.257576, 0.257576, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.257576, 0.257576, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.257576, 0.257576, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.257576, 0.257576, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.257576, 0.257576, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.257576, 0.257576, 0.266667, 0.3, 0.35, 0.433333, 0.6, 1.1, 0.6, 0.433333, 0.35, 0.3, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, }, 
-{0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 0.290909, 0.290909, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.290909, 0.290909, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.290909, 0.290909, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.290909, 0.290909, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.290909, 0.290909, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.290909, 0.290909, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.290909, 0.290909, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.290909, 0.290909, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.290909, 0.290909, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 1.1, 0.6, 0.433333, 0.35, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, }, 
-{0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 0.340909, 0.340909, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.340909, 0.340909, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.340909, 0.340909, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.340909, 0.340909, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.340909, 0.340909, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.340909, 0.340909, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.340909, 0.340909, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.340909, 0.340909, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.340909, 0.340909, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 1.1, 0.6, 0.433333, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, }, 
-{0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 0.424242, 0.424242, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.424242, 0.424242, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.424242, 0.424242, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.424242, 0.424242, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.424242, 0.424242, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.424242, 0.424242, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.424242, 0.424242, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.424242, 0.424242, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.424242, 0.424242, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 1.1, 0.6, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, }, 
-{0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 1.1, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 0.590909, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.590909, 0.590909, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.590909, 0.590909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.590909, 0.590909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.590909, 0.590909, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.590909, 0.590909, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.590909, 0.590909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.590909, 0.590909, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.590909, 0.590909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 1.1, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.190909, 0.190909, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 1.1, 0.190909, 0.190909, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.190909, 0.190909, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.190909, 0.190909, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.35, 0.190909, 0.190909, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.3, 0.190909, 0.190909, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.190909, 0.190909, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.190909, 0.190909, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.236111, 0.225, 0.190909, 0.190909, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, 0.190909, }, 
-{0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.2, 0.2, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 0.2, 0.2, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.2, 0.2, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.2, 0.2, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.2, 0.2, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.2, 0.2, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.2, 0.2, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.2, 0.2, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.236111, 0.2, 0.2, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, }, 
-{0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.211111, 0.211111, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 0.211111, 0.211111, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.211111, 0.211111, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.211111, 0.211111, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.211111, 0.211111, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.211111, 0.211111, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.211111, 0.211111, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.211111, 0.211111, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.211111, 0.211111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, }, 
-{0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.225, 0.225, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 0.225, 0.225, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.225, 0.225, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.225, 0.225, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.225, 0.225, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.225, 0.225, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.225, 0.225, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.225, 0.225, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.225, 0.225, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, }, 
-{0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.242857, 0.242857, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 0.242857, 0.242857, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.242857, 0.242857, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.242857, 0.242857, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.242857, 0.242857, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.242857, 0.242857, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.242857, 0.242857, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.242857, 0.242857, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.242857, 0.242857, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, }, 
-{0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.266667, 0.266667, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 0.266667, 0.266667, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.266667, 0.266667, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.266667, 0.266667, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.266667, 0.266667, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.266667, 0.266667, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.266667, 0.266667, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.266667, 0.266667, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.266667, 0.266667, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, }, 
-{0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.3, 0.3, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 0.3, 0.3, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.3, 0.3, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.3, 0.3, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.3, 0.3, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.3, 0.3, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.3, 0.3, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.3, 0.3, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.3, 0.3, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, }, 
-{0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.35, 0.35, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 0.35, 0.35, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.35, 0.35, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.35, 0.35, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.35, 0.35, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.35, 0.35, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.35, 0.35, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.35, 0.35, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.35, 0.35, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, }, 
-{0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.433333, 0.433333, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 0.433333, 0.433333, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.433333, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.433333, 0.433333, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.433333, 0.433333, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.433333, 0.433333, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.433333, 0.433333, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.433333, 0.433333, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.433333, 0.433333, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, }, 
-{0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.6, 0.6, 1.1, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 0.6, 0.6, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.6, 0.6, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.6, 0.6, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.6, 0.6, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.6, 0.6, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.6, 0.6, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.6, 0.6, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.6, 0.6, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.20202, 0.20202, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.20202, 0.20202, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 1.1, 0.20202, 0.20202, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.20202, 0.20202, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.20202, 0.20202, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.35, 0.20202, 0.20202, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.3, 0.20202, 0.20202, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.20202, 0.20202, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.20202, 0.20202, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.236111, 0.225, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, 0.20202, }, 
-{0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.211111, 0.211111, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.211111, 0.211111, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 0.211111, 0.211111, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.211111, 0.211111, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.211111, 0.211111, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.211111, 0.211111, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.211111, 0.211111, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.211111, 0.211111, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.211111, 0.211111, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.236111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, 0.211111, }, 
-{0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.222222, 0.222222, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.222222, 0.222222, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 0.222222, 0.222222, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.222222, 0.222222, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.222222, 0.222222, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.222222, 0.222222, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.222222, 0.222222, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.222222, 0.222222, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.222222, 0.222222, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, 0.222222, }, 
-{0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.236111, 0.236111, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.236111, 0.236111, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 0.236111, 0.236111, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.236111, 0.236111, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.236111, 0.236111, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.236111, 0.236111, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.236111, 0.236111, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.236111, 0.236111, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.236111, 0.236111, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, }, 
-{0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.253968, 0.253968, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.253968, 0.253968, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 0.253968, 0.253968, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.253968, 0.253968, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.253968, 0.253968, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.253968, 0.253968, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.253968, 0.253968, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.253968, 0.253968, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.253968, 0.253968, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, }, 
-{0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.277778, 0.277778, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.277778, 0.277778, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 0.277778, 0.277778, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.277778, 0.277778, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.277778, 0.277778, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.277778, 0.277778, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.277778, 0.277778, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.277778, 0.277778, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.277778, 0.277778, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, }, 
-{0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.311111, 0.311111, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.311111, 0.311111, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 0.311111, 0.311111, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.311111, 0.311111, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.311111, 0.311111, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.311111, 0.311111, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.311111, 0.311111, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.311111, 0.311111, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.311111, 0.311111, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, }, 
-{0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.361111, 0.361111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.361111, 0.361111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 0.361111, 0.361111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.361111, 0.361111, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.361111, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.361111, 0.361111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.361111, 0.361111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.361111, 0.361111, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.361111, 0.361111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, }, 
-{0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.444444, 0.444444, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.444444, 0.444444, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 0.444444, 0.444444, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.444444, 0.444444, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.444444, 0.444444, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.444444, 0.444444, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.444444, 0.444444, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.444444, 0.444444, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.444444, 0.444444, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, }, 
-{0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.611111, 0.611111, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.611111, 0.611111, 1.1, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 0.611111, 0.611111, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.611111, 0.611111, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.611111, 0.611111, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.611111, 0.611111, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.611111, 0.611111, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.611111, 0.611111, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.611111, 0.611111, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.35, 0.215909, 0.215909, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.215909, 0.215909, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.215909, 0.215909, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 1.1, 0.215909, 0.215909, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.215909, 0.215909, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.215909, 0.215909, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.35, 0.215909, 0.215909, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.3, 0.215909, 0.215909, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.215909, 0.215909, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, 0.215909, }, 
-{0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.225, 0.225, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.225, 0.225, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.225, 0.225, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 0.225, 0.225, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.225, 0.225, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.225, 0.225, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.225, 0.225, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.225, 0.225, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.225, 0.225, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, 0.225, }, 
-{0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.236111, 0.236111, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.236111, 0.236111, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.236111, 0.236111, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 0.236111, 0.236111, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.236111, 0.236111, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.236111, 0.236111, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.236111, 0.236111, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.236111, 0.236111, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.236111, 0.236111, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, 0.236111, }, 
-{0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.25, 0.25, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.25, 0.25, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.25, 0.25, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 0.25, 0.25, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.25, 0.25, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.25, 0.25, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.25, 0.25, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.25, 0.25, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.25, 0.25, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, }, 
-{0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.267857, 0.267857, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.267857, 0.267857, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.267857, 0.267857, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 0.267857, 0.267857, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.267857, 0.267857, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.267857, 0.267857, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.267857, 0.267857, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.267857, 0.267857, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.267857, 0.267857, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, }, 
-{0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.291667, 0.291667, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.291667, 0.291667, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.291667, 0.291667, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 0.291667, 0.291667, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.291667, 0.291667, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.291667, 0.291667, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.291667, 0.291667, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.291667, 0.291667, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.291667, 0.291667, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, }, 
-{0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.325, 0.325, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.325, 0.325, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.325, 0.325, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 0.325, 0.325, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.325, 0.325, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.325, 0.325, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.325, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.325, 0.325, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.325, 0.325, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, }, 
-{0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.375, 0.375, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.375, 0.375, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.375, 0.375, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 0.375, 0.375, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.375, 0.375, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.375, 0.375, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.375, 0.375, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.375, 0.375, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.375, 0.375, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, }, 
-{0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.458333, 0.458333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.458333, 0.458333, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.458333, 0.458333, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 0.458333, 0.458333, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.458333, 0.458333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.458333, 0.458333, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.458333, 0.458333, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.458333, 0.458333, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.458333, 0.458333, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, }, 
-{0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.625, 0.625, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.625, 0.625, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.625, 0.625, 1.1, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 0.625, 0.625, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.625, 0.625, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.625, 0.625, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.625, 0.625, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.625, 0.625, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.625, 0.625, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.3, 0.233766, 0.233766, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.35, 0.233766, 0.233766, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.233766, 0.233766, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.233766, 0.233766, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 1.1, 0.233766, 0.233766, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.233766, 0.233766, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.233766, 0.233766, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.35, 0.233766, 0.233766, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.3, 0.233766, 0.233766, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, 0.233766, }, 
-{0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.242857, 0.242857, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.242857, 0.242857, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.242857, 0.242857, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.242857, 0.242857, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 0.242857, 0.242857, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.242857, 0.242857, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.242857, 0.242857, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.242857, 0.242857, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.242857, 0.242857, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, 0.242857, }, 
-{0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.253968, 0.253968, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.253968, 0.253968, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.253968, 0.253968, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.253968, 0.253968, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 0.253968, 0.253968, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.253968, 0.253968, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.253968, 0.253968, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.253968, 0.253968, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.253968, 0.253968, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, 0.253968, }, 
-{0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.267857, 0.267857, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.267857, 0.267857, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.267857, 0.267857, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.267857, 0.267857, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 0.267857, 0.267857, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.267857, 0.267857, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.267857, 0.267857, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.267857, 0.267857, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.267857, 0.267857, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, 0.267857, }, 
-{0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.285714, 0.285714, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.285714, 0.285714, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.285714, 0.285714, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.285714, 0.285714, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 0.285714, 0.285714, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.285714, 0.285714, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.285714, 0.285714, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.285714, 0.285714, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.285714, 0.285714, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, 0.285714, }, 
-{0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.309524, 0.309524, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.309524, 0.309524, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.309524, 0.309524, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.309524, 0.309524, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 0.309524, 0.309524, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.309524, 0.309524, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.309524, 0.309524, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.309524, 0.309524, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.309524, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, }, 
-{0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.342857, 0.342857, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.342857, 0.342857, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.342857, 0.342857, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.342857, 0.342857, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 0.342857, 0.342857, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.342857, 0.342857, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.342857, 0.342857, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.342857, 0.342857, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.342857, 0.342857, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, }, 
-{0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.392857, 0.392857, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.392857, 0.392857, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.392857, 0.392857, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.392857, 0.392857, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 0.392857, 0.392857, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.392857, 0.392857, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.392857, 0.392857, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.392857, 0.392857, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.392857, 0.392857, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, }, 
-{0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.47619, 0.47619, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.47619, 0.47619, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.47619, 0.47619, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.47619, 0.47619, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 0.47619, 0.47619, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.47619, 0.47619, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.47619, 0.47619, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.47619, 0.47619, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.47619, 0.47619, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, }, 
-{0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.642857, 0.642857, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.642857, 0.642857, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.642857, 0.642857, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.642857, 0.642857, 1.1, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 0.642857, 0.642857, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.642857, 0.642857, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.642857, 0.642857, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.642857, 0.642857, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.642857, 0.642857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.257576, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.3, 0.257576, 0.257576, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.35, 0.257576, 0.257576, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.257576, 0.257576, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.257576, 0.257576, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 1.1, 0.257576, 0.257576, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.257576, 0.257576, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.257576, 0.257576, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.35, 0.257576, 0.257576, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.3, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, 0.257576, }, 
-{0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.266667, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.266667, 0.266667, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.266667, 0.266667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.266667, 0.266667, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.266667, 0.266667, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 0.266667, 0.266667, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.266667, 0.266667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.266667, 0.266667, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.266667, 0.266667, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, 0.266667, }, 
-{0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.277778, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.277778, 0.277778, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.277778, 0.277778, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.277778, 0.277778, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.277778, 0.277778, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 0.277778, 0.277778, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.277778, 0.277778, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.277778, 0.277778, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.277778, 0.277778, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, 0.277778, }, 
-{0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.291667, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.291667, 0.291667, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.291667, 0.291667, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.291667, 0.291667, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.291667, 0.291667, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 0.291667, 0.291667, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.291667, 0.291667, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.291667, 0.291667, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.291667, 0.291667, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, 0.291667, }, 
-{0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.309524, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.309524, 0.309524, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.309524, 0.309524, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.309524, 0.309524, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.309524, 0.309524, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 0.309524, 0.309524, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.309524, 0.309524, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.309524, 0.309524, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.309524, 0.309524, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, 0.309524, }, 
-{0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.333333, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.333333, 0.333333, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.333333, 0.333333, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.333333, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.333333, 0.333333, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 0.333333, 0.333333, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.333333, 0.333333, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.333333, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.333333, 0.333333, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, 0.333333, }, 
-{0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.366667, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.366667, 0.366667, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.366667, 0.366667, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.366667, 0.366667, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.366667, 0.366667, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 0.366667, 0.366667, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.366667, 0.366667, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.366667, 0.366667, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.366667, 0.366667, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, }, 
-{0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.416667, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.416667, 0.416667, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.416667, 0.416667, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.416667, 0.416667, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.416667, 0.416667, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 0.416667, 0.416667, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.416667, 0.416667, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.416667, 0.416667, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.416667, 0.416667, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, }, 
-{0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.5, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.5, 0.5, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.5, 0.5, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.5, 0.5, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.5, 0.5, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 0.5, 0.5, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.5, 0.5, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.5, 0.5, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.5, 0.5, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, }, 
-{0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.666667, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.666667, 0.666667, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.666667, 0.666667, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.666667, 0.666667, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.666667, 0.666667, 1.1, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 0.666667, 0.666667, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.666667, 0.666667, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.666667, 0.666667, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.666667, 0.666667, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.290909, 0.290909, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.290909, 0.290909, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.3, 0.290909, 0.290909, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.35, 0.290909, 0.290909, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.290909, 0.290909, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.290909, 0.290909, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 1.1, 0.290909, 0.290909, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.290909, 0.290909, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.290909, 0.290909, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.35, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, 0.290909, }, 
-{0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.3, 0.3, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.3, 0.3, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.3, 0.3, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.3, 0.3, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.3, 0.3, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.3, 0.3, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 0.3, 0.3, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.3, 0.3, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.3, 0.3, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, 0.3, }, 
-{0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.311111, 0.311111, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.311111, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.311111, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.311111, 0.311111, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.311111, 0.311111, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.311111, 0.311111, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 0.311111, 0.311111, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.311111, 0.311111, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.311111, 0.311111, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, 0.311111, }, 
-{0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.325, 0.325, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.325, 0.325, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.325, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.325, 0.325, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.325, 0.325, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.325, 0.325, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 0.325, 0.325, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.325, 0.325, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.325, 0.325, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, 0.325, }, 
-{0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.342857, 0.342857, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.342857, 0.342857, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.342857, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.342857, 0.342857, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.342857, 0.342857, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.342857, 0.342857, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 0.342857, 0.342857, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.342857, 0.342857, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.342857, 0.342857, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, 0.342857, }, 
-{0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.366667, 0.366667, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.366667, 0.366667, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.366667, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.366667, 0.366667, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.366667, 0.366667, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.366667, 0.366667, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 0.366667, 0.366667, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.366667, 0.366667, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.366667, 0.366667, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, 0.366667, }, 
-{0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.4, 0.4, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.4, 0.4, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.4, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.4, 0.4, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.4, 0.4, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.4, 0.4, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 0.4, 0.4, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.4, 0.4, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.4, 0.4, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, }, 
-{0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.45, 0.45, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.45, 0.45, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.45, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.45, 0.45, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.45, 0.45, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.45, 0.45, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 0.45, 0.45, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.45, 0.45, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.45, 0.45, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, }, 
-{0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.533333, 0.533333, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.533333, 0.533333, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.533333, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.533333, 0.533333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.533333, 0.533333, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.533333, 0.533333, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 0.533333, 0.533333, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.533333, 0.533333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.533333, 0.533333, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, }, 
-{0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.7, 0.7, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.7, 0.7, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.7, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.7, 0.7, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.7, 0.7, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.7, 0.7, 1.1, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 0.7, 0.7, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.7, 0.7, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.7, 0.7, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.236111, 0.225, 0.340909, 0.340909, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.340909, 0.340909, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.340909, 0.340909, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.3, 0.340909, 0.340909, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.35, 0.340909, 0.340909, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.340909, 0.340909, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.340909, 0.340909, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 1.1, 0.340909, 0.340909, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.340909, 0.340909, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, 0.340909, }, 
-{0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.236111, 0.35, 0.35, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.35, 0.35, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.35, 0.35, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.35, 0.35, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.35, 0.35, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.35, 0.35, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.35, 0.35, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 0.35, 0.35, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.35, 0.35, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, 0.35, }, 
-{0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.361111, 0.361111, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.361111, 0.361111, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.361111, 0.361111, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.361111, 0.361111, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.361111, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.361111, 0.361111, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.361111, 0.361111, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 0.361111, 0.361111, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.361111, 0.361111, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, 0.361111, }, 
-{0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.375, 0.375, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.375, 0.375, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.375, 0.375, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.375, 0.375, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.375, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.375, 0.375, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.375, 0.375, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 0.375, 0.375, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.375, 0.375, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, 0.375, }, 
-{0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.392857, 0.392857, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.392857, 0.392857, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.392857, 0.392857, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.392857, 0.392857, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.392857, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.392857, 0.392857, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.392857, 0.392857, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 0.392857, 0.392857, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.392857, 0.392857, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, 0.392857, }, 
-{0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.416667, 0.416667, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.416667, 0.416667, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.416667, 0.416667, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.416667, 0.416667, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.416667, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.416667, 0.416667, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.416667, 0.416667, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 0.416667, 0.416667, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.416667, 0.416667, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, 0.416667, }, 
-{0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.45, 0.45, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.45, 0.45, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.45, 0.45, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.45, 0.45, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.45, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.45, 0.45, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.45, 0.45, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 0.45, 0.45, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.45, 0.45, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, 0.45, }, 
-{0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.5, 0.5, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.5, 0.5, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.5, 0.5, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.5, 0.5, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.5, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.5, 0.5, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.5, 0.5, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 0.5, 0.5, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.5, 0.5, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, }, 
-{0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.583333, 0.583333, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.583333, 0.583333, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.583333, 0.583333, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.583333, 0.583333, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.583333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.583333, 0.583333, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.583333, 0.583333, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 0.583333, 0.583333, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.583333, 0.583333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, }, 
-{0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.75, 0.75, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.75, 0.75, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.75, 0.75, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.75, 0.75, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.75, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.75, 0.75, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.75, 0.75, 1.1, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 0.75, 0.75, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.75, 0.75, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.424242, 0.424242, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.236111, 0.225, 0.424242, 0.424242, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.424242, 0.424242, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.424242, 0.424242, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.3, 0.424242, 0.424242, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.35, 0.424242, 0.424242, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.424242, 0.424242, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.424242, 0.424242, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 1.1, 0.424242, 0.424242, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, 0.424242, }, 
-{0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.433333, 0.433333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.236111, 0.433333, 0.433333, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.433333, 0.433333, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.433333, 0.433333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.433333, 0.433333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.433333, 0.433333, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.433333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.433333, 0.433333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 0.433333, 0.433333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, 0.433333, }, 
-{0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.444444, 0.444444, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.444444, 0.444444, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.444444, 0.444444, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.444444, 0.444444, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.444444, 0.444444, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.444444, 0.444444, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.444444, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.444444, 0.444444, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 0.444444, 0.444444, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, 0.444444, }, 
-{0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.458333, 0.458333, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.458333, 0.458333, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.458333, 0.458333, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.458333, 0.458333, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.458333, 0.458333, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.458333, 0.458333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.458333, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.458333, 0.458333, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 0.458333, 0.458333, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, 0.458333, }, 
-{0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.47619, 0.47619, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.47619, 0.47619, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.47619, 0.47619, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.47619, 0.47619, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.47619, 0.47619, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.47619, 0.47619, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.47619, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.47619, 0.47619, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 0.47619, 0.47619, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, 0.47619, }, 
-{0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.5, 0.5, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.5, 0.5, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.5, 0.5, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.5, 0.5, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.5, 0.5, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.5, 0.5, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.5, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.5, 0.5, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 0.5, 0.5, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, }, 
-{0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.533333, 0.533333, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.533333, 0.533333, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.533333, 0.533333, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.533333, 0.533333, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.533333, 0.533333, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.533333, 0.533333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.533333, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.533333, 0.533333, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 0.533333, 0.533333, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, 0.533333, }, 
-{0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.583333, 0.583333, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.583333, 0.583333, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.583333, 0.583333, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.583333, 0.583333, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.583333, 0.583333, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.583333, 0.583333, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.583333, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.583333, 0.583333, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 0.583333, 0.583333, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, 0.583333, }, 
-{0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.666667, 0.666667, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.666667, 0.666667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.666667, 0.666667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.666667, 0.666667, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.666667, 0.666667, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.666667, 0.666667, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.666667, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.666667, 0.666667, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 0.666667, 0.666667, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, }, 
-{0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.833333, 0.833333, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.833333, 0.833333, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.833333, 0.833333, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.833333, 0.833333, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.833333, 0.833333, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.833333, 0.833333, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.833333, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.833333, 0.833333, 1.1, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 0.833333, 0.833333, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 1.1, 0.6, 0.433333, 0.35, 0.3, 0.266667, 0.242857, 0.225, 0.211111, 0.2, 0.590909, 0.590909, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.590909, 0.590909, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.236111, 0.225, 0.590909, 0.590909, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.590909, 0.590909, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.590909, 0.590909, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.3, 0.590909, 0.590909, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.35, 0.590909, 0.590909, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.433333, 0.590909, 0.590909, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.590909, 0.590909, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 1.1, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, 0.590909, }, 
-{0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 1.1, 0.6, 0.433333, 0.35, 0.3, 0.266667, 0.242857, 0.225, 0.211111, 0.6, 0.6, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.6, 0.6, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.236111, 0.6, 0.6, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.6, 0.6, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.6, 0.6, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.311111, 0.6, 0.6, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.361111, 0.6, 0.6, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.444444, 0.6, 0.6, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.6, 0.6, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 1.11111, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, }, 
-{0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.433333, 0.6, 1.1, 0.6, 0.433333, 0.35, 0.3, 0.266667, 0.242857, 0.225, 0.611111, 0.611111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.611111, 0.611111, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.25, 0.611111, 0.611111, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.611111, 0.611111, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.611111, 0.611111, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.325, 0.611111, 0.611111, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.375, 0.611111, 0.611111, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.458333, 0.611111, 0.611111, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.611111, 0.611111, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 1.125, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, 0.611111, }, 
-{0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.35, 0.433333, 0.6, 1.1, 0.6, 0.433333, 0.35, 0.3, 0.266667, 0.242857, 0.625, 0.625, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.625, 0.625, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.267857, 0.625, 0.625, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.285714, 0.625, 0.625, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.309524, 0.625, 0.625, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.342857, 0.625, 0.625, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.392857, 0.625, 0.625, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.47619, 0.625, 0.625, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.625, 0.625, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 1.14286, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, 0.625, }, 
-{0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.3, 0.35, 0.433333, 0.6, 1.1, 0.6, 0.433333, 0.35, 0.3, 0.266667, 0.642857, 0.642857, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.642857, 0.642857, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.291667, 0.642857, 0.642857, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.309524, 0.642857, 0.642857, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.333333, 0.642857, 0.642857, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.366667, 0.642857, 0.642857, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.416667, 0.642857, 0.642857, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.5, 0.642857, 0.642857, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.642857, 0.642857, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 1.16667, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, 0.642857, }, 
-{0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.266667, 0.3, 0.35, 0.433333, 0.6, 1.1, 0.6, 0.433333, 0.35, 0.3, 0.666667, 0.666667, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.311111, 0.666667, 0.666667, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.325, 0.666667, 0.666667, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.342857, 0.666667, 0.666667, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.366667, 0.666667, 0.666667, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.4, 0.666667, 0.666667, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.45, 0.666667, 0.666667, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.533333, 0.666667, 0.666667, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.666667, 0.666667, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 1.2, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, 0.666667, }, 
-{0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 1.1, 0.6, 0.433333, 0.35, 0.7, 0.7, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.361111, 0.7, 0.7, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.375, 0.7, 0.7, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.392857, 0.7, 0.7, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.416667, 0.7, 0.7, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.45, 0.7, 0.7, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.5, 0.7, 0.7, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.583333, 0.7, 0.7, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.7, 0.7, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 1.25, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, }, 
-{0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 1.1, 0.6, 0.433333, 0.75, 0.75, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.444444, 0.75, 0.75, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.458333, 0.75, 0.75, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.47619, 0.75, 0.75, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.5, 0.75, 0.75, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.533333, 0.75, 0.75, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.583333, 0.75, 0.75, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.666667, 0.75, 0.75, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.75, 0.75, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 1.33333, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, 0.75, }, 
-{0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 1.1, 0.6, 0.833333, 0.833333, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 0.611111, 0.833333, 0.833333, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 0.625, 0.833333, 0.833333, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 0.642857, 0.833333, 0.833333, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 0.666667, 0.833333, 0.833333, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 0.7, 0.833333, 0.833333, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 0.75, 0.833333, 0.833333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 0.833333, 0.833333, 0.833333, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 0.833333, 0.833333, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1.5, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, 0.833333, }, 
-{1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 1.1, 1, 1, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.11111, 1, 1, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 1.125, 1, 1, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 1.14286, 1, 1, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 1.16667, 1, 1, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 1.2, 1, 1, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 1.25, 1, 1, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 1.33333, 1, 1, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 1.5, 1, 1, 1.1, 1.11111, 1.125, 1.14286, 1.16667, 1.2, 1.25, 1.33333, 1.5, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0.181818, 0.190909, 0.20202, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 2, 2, 0.190909, 0.2, 0.211111, 0.225, 0.242857, 0.266667, 0.3, 0.35, 0.433333, 0.6, 2, 2, 0.20202, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 2, 2, 0.215909, 0.225, 0.236111, 0.25, 0.267857, 0.291667, 0.325, 0.375, 0.458333, 0.625, 2, 2, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.47619, 0.642857, 2, 2, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.5, 0.666667, 2, 2, 0.290909, 0.3, 0.311111, 0.325, 0.342857, 0.366667, 0.4, 0.45, 0.533333, 0.7, 2, 2, 0.340909, 0.35, 0.361111, 0.375, 0.392857, 0.416667, 0.45, 0.5, 0.583333, 0.75, 2, 2, 0.424242, 0.433333, 0.444444, 0.458333, 0.47619, 0.5, 0.533333, 0.583333, 0.666667, 0.833333, 2, 2, 0.590909, 0.6, 0.611111, 0.625, 0.642857, 0.666667, 0.7, 0.75, 0.833333, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, }, 
-};
\ No newline at end of file
@@ -0,0 +1,295 @@
+/**
+ * Copyright (c) 2012 MIT License by 6.172 Staff
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ **/
+
+// Kernel microbenchmarks
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+
+#include "eval.h"
+#include "fen.h"
+#include "kbench.h"
+#include "move_gen.h"
+#include "search.h"
+#include "tt.h"
+#include "util.h"
+
+extern int USE_TT;
+
+// The corpus is the positions every KB_STRIDE plies into KB_GAMES random
+// games from the start.  Moves that would zap a king are not played.
+#define KB_GAMES  32
+#define KB_PLIES  32
+#define KB_STRIDE 4
+#define KB_POSITIONS (KB_GAMES * (KB_PLIES / KB_STRIDE))
+
+#define KB_WARMUP 3                // untimed runs before the samples
+#define KB_MIN_SAMPLE_NS 10000000  // a sample repeats runs to last this long
+
+typedef struct {
+  position_t      *pos[KB_POSITIONS];
+  sortable_move_t  moves[KB_POSITIONS][MAX_NUM_MOVES];
+  int              num_moves[KB_POSITIONS];
+  position_t      *games;     // KB_GAMES * (KB_PLIES + 1) positions
+  undo_t          *undos;     // and the undo records they hang off
+} corpus_t;
+
+// A kernel runs once on p, whose moves are given, and returns something
+// that depends on its result, so that the work cannot be optimized away.
+// It adds the operations it timed to *ops.
+typedef uint64_t (*kernel_t)(position_t *p, sortable_move_t *moves,
+                             int num_moves, uint64_t *ops);
+
+static double ns_now() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return 1e9 * t.tv_sec + t.tv_nsec;
+}
+
+static void make_corpus(corpus_t *c) {
+  c->games = (position_t *) malloc(sizeof(position_t) * KB_GAMES *
+                                   (KB_PLIES + 1));
+  c->undos = (undo_t *) malloc(sizeof(undo_t) * KB_GAMES * (KB_PLIES + 1));
+  reset_myrand();
+
+  int n = 0;
+  for (int g = 0; g < KB_GAMES; g++) {
+    position_t *game = c->games + g * (KB_PLIES + 1);
+    undo_t *undo = c->undos + g * (KB_PLIES + 1);
+    fen_to_pos(&game[0], "");
+    for (int ply = 1; ply <= KB_PLIES; ply++) {
+      sortable_move_t lst[MAX_NUM_MOVES];
+      int num_moves = generate_all(&game[ply - 1], lst);
+      // try moves from a random one on until one is legal and not a win
+      int first = myrand() % num_moves;
+      for (int i = 0; i < num_moves; i++) {
+        game[ply] = game[ply - 1];
+        move_t mv = get_move(lst[(first + i) % num_moves]);
+        piece_t victim = make_move(&game[ply], mv, &undo[ply]);
+        if (victim == KO) {
+          continue;
+        }
+        if (ptype_of(victim) != KING) {
+          break;
+        }
+        unmake_move(&game[ply], &undo[ply]);
+      }
+      if (ply % KB_STRIDE == 0) {
+        c->pos[n] = &game[ply];
+        c->num_moves[n] = generate_all(&game[ply], c->moves[n]);
+        n++;
+      }
+    }
+  }
+  assert(n == KB_POSITIONS);
+}
+
+static void free_corpus(corpus_t *c) {
+  free(c->games);
+  free(c->undos);
+}
+
+// Forgets the lasers cached in p, so that a kernel does the work a freshly
+// made position needs.
+static inline void forget_lasers(position_t *p) {
+  for (int c = 0; c < 2; c++) {
+    p->laser[c].key = 0;
+    p->laser[c].h_key = 0;
+  }
+}
+
+static uint64_t kb_generate_all(position_t *p, sortable_move_t *moves,
+                                int num_moves, uint64_t *ops) {
+  sortable_move_t lst[MAX_NUM_MOVES];
+  forget_lasers(p);
+  (*ops)++;
+  return generate_all(p, lst);
+}
+
+static uint64_t kb_generate_all_old(position_t *p, sortable_move_t *moves,
+                                    int num_moves, uint64_t *ops) {
+  sortable_move_t lst[MAX_NUM_MOVES];
+  (*ops)++;
+  return generate_all_old(p, lst, false);
+}
+
+// one make_move and unmake_move of each move
+static uint64_t kb_make_move(position_t *p, sortable_move_t *moves,
+                             int num_moves, uint64_t *ops) {
+  uint64_t sum = 0;
+  for (int i = 0; i < num_moves; i++) {
+    undo_t undo;
+    piece_t victim = make_move(p, get_move(moves[i]), &undo);
+    if (victim != KO) {
+      unmake_move(p, &undo);
+    }
+    sum += victim;
+  }
+  *ops += num_moves;
+  return sum;
+}
+
+static uint64_t kb_fire(position_t *p, sortable_move_t *moves,
+                        int num_moves, uint64_t *ops) {
+  forget_lasers(p);
+  (*ops)++;
+  return fire(p);
+}
+
+static uint64_t kb_fire_old(position_t *p, sortable_move_t *moves,
+                            int num_moves, uint64_t *ops) {
+  (*ops)++;
+  return fire_old(p);
+}
+
+static uint64_t kb_eval(position_t *p, sortable_move_t *moves,
+                        int num_moves, uint64_t *ops) {
+  forget_lasers(p);
+  (*ops)++;
+  return eval(p, false);
+}
+
+static uint64_t kb_eval_old(position_t *p, sortable_move_t *moves,
+                            int num_moves, uint64_t *ops) {
+  (*ops)++;
+  return unoptimized_eval(p, false);
+}
+
+// both colors
+static uint64_t kb_h_attackable(position_t *p, sortable_move_t *moves,
+                                int num_moves, uint64_t *ops) {
+  forget_lasers(p);
+  *ops += 2;
+  return h_squares_attackable(p, WHITE) + h_squares_attackable(p, BLACK);
+}
+
+static uint64_t kb_h_attackable_old(position_t *p, sortable_move_t *moves,
+                                    int num_moves, uint64_t *ops) {
+  *ops += 2;
+  return h_squares_attackable_old(p, WHITE) +
+         h_squares_attackable_old(p, BLACK);
+}
+
+// a probe for each position and each of its children
+static uint64_t kb_tt_get(position_t *p, sortable_move_t *moves,
+                          int num_moves, uint64_t *ops) {
+  uint64_t sum = 0;
+  ttRec_t rec;
+  sum += tt_hashtable_get(p->key, &rec);
+  for (int i = 0; i < num_moves; i++) {
+    sum += tt_hashtable_get(p->key ^ moves[i], &rec);
+  }
+  *ops += num_moves + 1;
+  return sum;
+}
+
+static const struct {
+  const char *name;
+  kernel_t    kernel;
+  kernel_t    old;      // reference version, or NULL
+} kernels[] = {
+  { "generate_all",         kb_generate_all,  kb_generate_all_old },
+  { "make_move",            kb_make_move,     NULL },
+  { "fire",                 kb_fire,          kb_fire_old },
+  { "eval",                 kb_eval,          kb_eval_old },
+  { "h_squares_attackable", kb_h_attackable,  kb_h_attackable_old },
+  { "tt_hashtable_get",     kb_tt_get,        NULL },
+};
+
+static volatile uint64_t kb_sink;   // where kernel results go
+
+// Runs kernel over the corpus reps times, counting its operations into
+// *ops.  Returns the time taken in ns.
+static double time_kernel(corpus_t *c, kernel_t kernel, int reps,
+                          uint64_t *ops) {
+  uint64_t sum = 0;
+  *ops = 0;
+  double start = ns_now();
+  for (int r = 0; r < reps; r++) {
+    for (int i = 0; i < KB_POSITIONS; i++) {
+      sum += kernel(c->pos[i], c->moves[i], c->num_moves[i], ops);
+    }
+  }
+  double elapsed = ns_now() - start;
+  kb_sink += sum;
+  return elapsed;
+}
+
+// Times samples runs of kernel, after warming it up, and returns the
+// median ns per operation, which shrugs off runs slowed by interrupts,
+// and the minimum.
+static void bench_kernel(corpus_t *c, kernel_t kernel, int samples,
+                         double *median, double *min) {
+  uint64_t ops;
+  int reps = 1;
+  while (time_kernel(c, kernel, reps, &ops) < KB_MIN_SAMPLE_NS) {
+    reps *= 2;
+  }
+  for (int w = 0; w < KB_WARMUP; w++) {
+    time_kernel(c, kernel, reps, &ops);
+  }
+
+  double *ns = (double *) malloc(sizeof(double) * samples);
+  for (int s = 0; s < samples; s++) {
+    ns[s] = time_kernel(c, kernel, reps, &ops) / ops;
+  }
+  std::sort(ns, ns + samples);
+  *median = ns[samples / 2];
+  *min = ns[0];
+  free(ns);
+}
+
+void kernel_bench(int samples) {
+  // the corpus restarts myrand, which shuffles the root moves of a search,
+  // so it is put back afterwards
+  myrand_state_t save_myrand;
+  get_myrand_state(&save_myrand);
+  corpus_t *c = (corpus_t *) malloc(sizeof(corpus_t));
+  make_corpus(c);
+  int save_use_tt = USE_TT;
+  USE_TT = 1;
+
+  printf("info string kbench %d positions, median and min of %d samples\n",
+         KB_POSITIONS, samples);
+  for (unsigned k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+    double median, min;
+    bench_kernel(c, kernels[k].kernel, samples, &median, &min);
+    printf("info string kbench %-22s %9.1f ns/op (min %9.1f)", kernels[k].name,
+           median, min);
+    if (kernels[k].old != NULL) {
+      double old_median, old_min;
+      bench_kernel(c, kernels[k].old, samples, &old_median, &old_min);
+      printf("  old %9.1f ns/op (min %9.1f)  %.2fx", old_median, old_min,
+             old_median / median);
+    }
+    printf("\n");
+  }
+
+  USE_TT = save_use_tt;
+  set_myrand_state(&save_myrand);
+  free_corpus(c);
+  free(c);
+}
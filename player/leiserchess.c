@@ -28,24 +28,32 @@
 #include <assert.h>
 #include <sys/stat.h>
 #include <stdbool.h>
+#include <pthread.h>
 
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
 
 #include "eval.h"
 #include "fen.h"
+#include "kbench.h"
 #include "move_gen.h"
 #include "search.h"
+#include "stats.h"
 #include "tt.h"
 #include "util.h"
 
 char  VERSION[] = "1038";
 
 
-#define MAX_HASH 4096       // 4 GB
+#define MAX_HASH 1048576    // 1 TB
 #define INF_TIME 99999999999.0
 #define INF_DEPTH 999       // if user does not specify a depth, use 999
 
+// Deepest iteration searched.  Each capture extends the search by a ply, so
+// this leaves room below MAX_PLY_IN_SEARCH, which sizes the killers and PVs,
+// for capturing every piece.
+#define MAX_SEARCH_DEPTH (MAX_PLY_IN_SEARCH - 1 - 2 * (PAWNS_COUNT + 1))
+
 // if the time remain is less than this fraction, dont start the next search iteration
 #define RATIO_FOR_TIMEOUT 0.5 
 
@@ -67,6 +75,7 @@ extern int USE_NMM;
 extern int FUT_DEPTH;
 extern int TRACE_MOVES;
 extern int DETECT_DRAWS;
+extern int THREADS;
 
 // defined in eval.c
 extern int RANDOMIZE;
@@ -76,6 +85,7 @@ extern int PMIRROR;
 extern int PBETWEEN;
 extern int KFACE;
 extern int KAGGRESSIVE;
+extern int EVAL_CACHE;
 
 // defined in move_gen.c
 extern int USE_KO;
@@ -83,6 +93,10 @@ extern int USE_KO;
 // defined in tt.c
 extern int USE_TT;
 extern int HASH;
+extern int HUGE_PAGES;
+
+// defined here
+static int PONDER;
 
 
 
@@ -110,12 +124,16 @@ static int_options iopts[] = {
   { "kface",                     &KFACE,   0.3 * PAWN_EV_VALUE,   0,              PAWN_EV_VALUE },
   { "pbetween",               &PBETWEEN,   0.3 * PAWN_EV_VALUE,   -PAWN_EV_VALUE, PAWN_EV_VALUE },
   { "hash",                       &HASH,   16,                    1,              MAX_HASH   },
+  { "threads",                 &THREADS,   1,                     1,              MAX_THREADS   },
+  { "huge_pages",           &HUGE_PAGES,   1,                     0,              1             },
+  { "eval_cache",           &EVAL_CACHE,   1024,                  0,              1 << 20       },
   { "draw",                       &DRAW,   -0.07 * PAWN_VALUE,    -PAWN_VALUE,    PAWN_VALUE    },
   { "randomize",             &RANDOMIZE,   0,                     0,              PAWN_EV_VALUE },
   { "lmr_r1",                   &LMR_R1,   5,                     1,              MAX_NUM_MOVES },
   { "lmr_r2",                   &LMR_R2,   20,                    1,              MAX_NUM_MOVES },
   { "hmb",                         &HMB,   0.03 * PAWN_VALUE,     0,              PAWN_VALUE    },
   { "fut_depth",             &FUT_DEPTH,   3,                     0,              5             },
+  { "ponder",                   &PONDER,   0,                     0,              1             },
   // debug options
   { "use_nmm",                 &USE_NMM,   1,                     0,              1             },
   { "detect_draws",       &DETECT_DRAWS,   1,                     0,              1             },
@@ -146,8 +164,9 @@ void lower_case(char *s) {
 }
 
 // Returns victim or 0 if no victim or -1 if illegal move
-// makes the move described by 'mvstring'
-piece_t make_from_string(position_t *old, position_t *p,
+// makes the move described by 'mvstring' on a copy p of old, keeping the
+// record for taking it back in *undo
+piece_t make_from_string(position_t *old, position_t *p, undo_t *undo,
                          const char *mvstring) {
   sortable_move_t lst[MAX_NUM_MOVES];
   move_t mv = 0;
@@ -169,28 +188,143 @@ piece_t make_from_string(position_t *old, position_t *p,
     }
   }
 
-  return (mv == 0) ? -1 : make_move(old, p, mv);
+  if (mv == 0) {
+    return -1;
+  }
+  *p = *old;
+  return make_move(p, mv, undo);
 }
 
 static char theMove[MAX_CHARS_IN_MOVE];
 
+// ----------------------------------------------------------------------
+// Pondering
+//
+// "go ponder" searches the position the opponent is expected to leave,
+// on the opponent's time, in a thread of its own so that the command loop
+// goes on reading.  The search has no clock until "ponderhit" says the
+// opponent made the move: then its clock starts with the goal the go
+// command gave, and it goes on from the depth it reached, its hash table
+// warm.  "stop" ends it.  Either way it answers bestmove, and only then.
+// With the ponder option on, bestmove names the reply to ponder on, the
+// second move of its PV.
+
+static pthread_t       ponder_thread;
+static bool            ponder_running = false;  // ponder_thread to be joined
+static volatile bool   pondering = false;       // no ponderhit or stop yet
+static volatile bool   ponder_stopped = false;  // a stop ended the search
+static pthread_mutex_t ponder_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  ponder_cond = PTHREAD_COND_INITIALIZER;
+
+static struct {
+  position_t *p;
+  int         depth;
+  double      goal;   // time goal from ponderhit on
+} ponder_search;
+
+void  UciBeginSearch(position_t *p, int depth, double tme);
+
+static void *ponder_main(void *arg) {
+  UciBeginSearch(ponder_search.p, ponder_search.depth, ponder_search.goal);
+  return NULL;
+}
+
+static void ponder_start(position_t *p, int depth, double goal) {
+  ponder_search.p = p;
+  ponder_search.depth = depth;
+  ponder_search.goal = goal;
+  pondering = true;
+  ponder_stopped = false;
+  if (pthread_create(&ponder_thread, NULL, ponder_main, NULL) != 0) {
+    fprintf(OUT, "info string ponder thread failed, searching now\n");
+    pondering = false;
+    ponder_main(NULL);
+    return;
+  }
+  ponder_running = true;
+}
+
+// Lets a search waiting on pondering go on.
+static void ponder_release() {
+  pthread_mutex_lock(&ponder_lock);
+  pondering = false;
+  pthread_cond_broadcast(&ponder_cond);
+  pthread_mutex_unlock(&ponder_lock);
+}
+
+// The opponent played the expected move: search on the clock from now.
+static void ponder_hit() {
+  pthread_mutex_lock(&ponder_lock);
+  if (pondering) {
+    init_abort_timer(ponder_search.goal);
+    pondering = false;
+    pthread_cond_broadcast(&ponder_cond);
+  }
+  pthread_mutex_unlock(&ponder_lock);
+}
+
+// Starts the clock of a search, unless it ponders; under the lock so that
+// a ponderhit cannot start it first.
+static void start_abort_timer(double goal) {
+  pthread_mutex_lock(&ponder_lock);
+  init_abort_timer(pondering ? INF_TIME : goal);
+  pthread_mutex_unlock(&ponder_lock);
+}
+
+// Waits for the ponder search to answer, first ending it if stop is set or
+// it is still pondering, since nothing else would end it.
+static void ponder_finish(bool stop) {
+  if (!ponder_running) {
+    return;
+  }
+  if (stop || pondering) {
+    ponder_stopped = true;
+    abort_search();
+    ponder_release();
+  }
+  pthread_join(ponder_thread, NULL);
+  ponder_running = false;
+  ponder_stopped = false;
+}
+
+// A ponder search ends here until ponderhit or stop.
+static void ponder_wait() {
+  pthread_mutex_lock(&ponder_lock);
+  while (pondering) {
+    pthread_cond_wait(&ponder_cond, &ponder_lock);
+  }
+  pthread_mutex_unlock(&ponder_lock);
+}
+
 void  UciBeginSearch(position_t *p, int depth, double tme) {
   move_t subpv[MAX_PLY_IN_SEARCH];
   char pvbuf[MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE];
   double et = 0.0;
   char bms[MAX_CHARS_IN_MOVE];
+  char pms[MAX_CHARS_IN_MOVE];
 
   // start time of search
-  init_abort_timer(tme);
+  start_abort_timer(tme);
   init_best_move_history();
 
   uint64_t  node_count = 0;
+  uint64_t  evc_hits0, evc_probes0;
+  eval_cache_stats(&evc_hits0, &evc_probes0);
 
   tt_age_hashtable();
   init_tics();
+  stats_reset();
+
+  // a search without a clock, like pondering, would otherwise go on
+  // deepening; a ponder search then waits below for ponderhit or stop
+  if (depth > MAX_SEARCH_DEPTH) {
+    depth = MAX_SEARCH_DEPTH;
+  }
 
   for (int d = 1; d <= depth; d++) {  // Iterative deepening
     reset_abort();
+    // a stop must not be lost to the reset; depth 1 always gets a move
+    if (ponder_stopped && d > 1) break;
     searchRoot(p, -INF, INF, d, 0, subpv, &node_count, OUT);
     et = elapsed_time();
 
@@ -208,19 +342,144 @@ void  UciBeginSearch(position_t *p, int depth, double tme) {
       fprintf(OUT, "info depth %d move_no %d time (microsec) %d nodes %" PRIu64 
               " nps %" PRIu64 "\n",
               d, 0, (int) (et * 1000), node_count, nps);
+      stats_print(OUT);
     } else {
       break;   // aborted
     }
 
     // don't start iteration that you cannot complete
-    if (et > tme * RATIO_FOR_TIMEOUT) break; 
+    if (!pondering && et > tme * RATIO_FOR_TIMEOUT) break;
   }
 
-  fprintf(OUT, "bestmove %s\n", bms);
+  ponder_wait();
+
+  uint64_t evc_hits, evc_probes;
+  eval_cache_stats(&evc_hits, &evc_probes);
+  evc_hits -= evc_hits0;
+  evc_probes -= evc_probes0;
+  fprintf(OUT, "info string eval cache hits %" PRIu64 " of %" PRIu64
+          " probes (%.1f%%)\n", evc_hits, evc_probes,
+          evc_probes ? 100.0 * evc_hits / evc_probes : 0.0);
+
+  if (PONDER && subpv[0] != 0 && subpv[1] != 0) {
+    move_to_str(subpv[1], pms);
+    fprintf(OUT, "bestmove %s ponder %s\n", bms, pms);
+  } else {
+    fprintf(OUT, "bestmove %s\n", bms);
+  }
 
   return;
 }
 
+// Positions searched by "bench": the start, openings from tests/book.dta,
+// then middlegames and endgames.  Each is a FEN ("" for the start) and the
+// moves made from it.
+#define BENCH_DEPTH 5
+#define BENCH_MAX_MOVES 16
+
+static const struct {
+  const char *fen;
+  const char *moves;
+} bench_positions[] = {
+  { "", "" },
+  { "", "e4d3 a5a4 f4f5 f4g4 i3h3 e9d9 f0e0 a4b3 j4j5 b3a2" },
+  { "", "e4e5 f5g5 e5d4 e4d4 e4d5 g5g6 d5c4 d4c3 f4g4 g6h5" },
+  { "", "f4f5 f4g4 f5g6 e5e6 e4d3 g4h3 i3h3 i3h4 j4i4 c7d7" },
+  { "", "j4i5 a5b4 i5j6 f5f6 h2h1 b4a3 e4e3 a3a2 e3d2 a2a1" },
+  { "3ss6/3nw6/2nw7/10/nw4ne4/4SW5/8SE1/7SE2/6SE3/4NN5 W", "" },
+  { "ss3nw5/10/2nw4SE2/1nw8/4nwne4/4SWSE4/10/7SE2/3NN6/10 B", "" },
+  { "10/3ss6/10/2nw7/10/10/6SE3/10/5NN4/10 W", "" },
+  { "10/10/4se5/3ss6/10/10/5NN4/4NW5/10/10 B", "" },
+  { "ss9/10/10/10/10/10/10/10/10/9NN W", "" },
+};
+
+// Empties what one search leaves for the next: the hash table, the eval
+// cache, and the killers and move history.
+static void reset_search_state() {
+  tt_clear_hashtable();
+  eval_cache_clear();
+  init_killer();
+  init_best_move_history();
+}
+
+// Searches each of bench_positions to depth from a fresh hash table, eval
+// cache, move history and move shuffle, with the hash table on, no
+// randomizing and one thread, and reports its nodes and best move.  Then
+// reports their total, which is a fingerprint of what the search does, and
+// the nodes per second.  The total also depends on the hash size and the
+// search options, so the summary names the hash size.  It empties the hash
+// table, eval cache and move history again at the end, and puts the move
+// shuffle back where it was, so a search after it runs as in a session that
+// has not searched since they were last emptied.
+static void bench(int depth) {
+  int num_positions = sizeof(bench_positions) / sizeof(bench_positions[0]);
+  position_t pos[BENCH_MAX_MOVES + 1];
+  undo_t     pos_undo[BENCH_MAX_MOVES + 1];
+  move_t     pv[MAX_PLY_IN_SEARCH];
+  char       bms[MAX_CHARS_IN_MOVE];
+
+  FILE *quiet = fopen("/dev/null", "w");
+  if (quiet == NULL) {
+    fprintf(OUT, "info string bench could not open /dev/null\n");
+    return;
+  }
+  int save_use_tt = USE_TT;
+  int save_randomize = RANDOMIZE;
+  myrand_state_t save_myrand;
+  get_myrand_state(&save_myrand);
+  USE_TT = 1;
+  RANDOMIZE = 0;
+  init_threads(1);
+
+  uint64_t total = 0;
+  double start = milliseconds();
+
+  for (int i = 0; i < num_positions; i++) {
+    int ix = 0;
+    fen_to_pos(&pos[0], (char *) bench_positions[i].fen);
+    char moves[MAX_CHARS_IN_TOKEN * BENCH_MAX_MOVES];
+    strcpy(moves, bench_positions[i].moves);
+    for (char *mv = strtok(moves, " "); mv != NULL; mv = strtok(NULL, " ")) {
+      assert(ix < BENCH_MAX_MOVES);
+      if (make_from_string(&pos[ix], &pos[ix + 1], &pos_undo[ix + 1], mv) < 0) {
+        fprintf(OUT, "info string bench %d: move %s is illegal\n", i + 1, mv);
+        break;
+      }
+      ix++;
+    }
+
+    reset_search_state();
+    reset_myrand();
+    init_abort_timer(INF_TIME);
+    init_tics();
+
+    uint64_t node_count = 0;
+    for (int d = 1; d <= depth; d++) {
+      reset_abort();
+      searchRoot(&pos[ix], -INF, INF, d, 0, pv, &node_count, quiet);
+    }
+    move_to_str(pv[0], bms);
+    fprintf(OUT, "info string bench %d nodes %" PRIu64 " bestmove %s\n",
+            i + 1, node_count, bms);
+    total += node_count;
+  }
+
+  double et = milliseconds() - start;
+  if (et < 0.00001) {
+    et = 0.00001;
+  }
+  fprintf(OUT, "info string bench depth %d hash %d positions %d nodes %" PRIu64
+          " time (microsec) %d nps %" PRIu64 "\n", depth, HASH, num_positions,
+          total, (int) (et * 1000), (uint64_t) (1000 * total / et));
+
+  USE_TT = save_use_tt;
+  RANDOMIZE = save_randomize;
+  init_threads(THREADS);
+  reset_search_state();
+  set_myrand_state(&save_myrand);
+  fclose(quiet);
+}
+
 typedef enum {
     NONWHITESPACE_STARTS,  // next nonwhitespace starts token
     WHITESPACE_ENDS,       // next whitespace ends token
@@ -230,6 +489,12 @@ typedef enum {
 
 // print help messages in uci
 void help()  {
+  printf("bench     - Search a fixed set of positions and report the nodes of\n");
+  printf("            each, their total and the nodes per second.  Leaves the\n");
+  printf("            hash table, eval cache and move history empty.\n");
+  printf("            Sample usage: \n");
+  printf("                bench 6: search each position to depth 6 (default %d)\n",
+         BENCH_DEPTH);
   printf("eval      - Evaluate current position.\n");
   printf("display   - Display current board state.\n");
   printf("generate  - Generate all possible moves.\n");
@@ -238,19 +503,39 @@ void help()  {
   printf("            time <time_limit>: search assume you have <time> amount of time\n");
   printf("                               for the whole game.\n");
   printf("            inc <time_inc>:    set the fischer time increment for the search\n");
+  printf("            ponder:            search on the opponent's time, in the\n");
+  printf("                               background, until ponderhit or stop\n");
   printf("            Both time arguments are specified in milliseconds.\n");
   printf("            Sample usage: \n");
   printf("                go depth 4: search until depth 4\n");
   printf("help      - Display help (this info).\n");
   printf("isready   - Ask if the UCI engine is ready, if so it echoes \"readyok\".\n");
   printf("            This is mainly used to synchronize the engine with the GUI.\n");
+  printf("kbench    - Time generate_all, make_move, fire, eval and hash table\n");
+  printf("            probes on a corpus of positions, and the old versions of\n");
+  printf("            them, in ns per operation.\n");
+  printf("            Sample usage: \n");
+  printf("                kbench 31: report the median and min of 31 samples\n");
   printf("move      - Make a move for current player.\n");
   printf("            Sample usage: \n");
   printf("                move j0j1: move a piece from j0 to j1\n");
+  printf("ponderhit - The opponent played the move a \"go ponder\" search expected;\n");
+  printf("            it goes on searching, on the clock from now.\n");
   printf("perft     - Output the number of possible moves upto a given depth.\n");
   printf("            Used to verify move the generator.\n");
   printf("            Sample usage: \n");
   printf("                depth 3: generate all possible moves for depth 1--3\n");
+  printf("                perft 5 threads 4: count depths 1--5 on 4 threads,\n");
+  printf("                sharing counts of transpositions through a table\n");
+  printf("                the size of the hash option, and print the count\n");
+  printf("                under each root move at depth 5\n");
+  printf("ttbench   - Time hash table probes with and without prefetching.\n");
+  printf("            Sample usage: \n");
+  printf("                ttbench 1000000: time a million probes each way\n");
+  printf("ttstress  - Hammer the transposition table from several threads and\n");
+  printf("            check that no torn record is ever returned.\n");
+  printf("            Sample usage: \n");
+  printf("                ttstress 8: run the test with 8 threads\n");
   printf("position  - Set up the board using the fenstring given.  Possible arguments are:\n");
   printf("            startpos:      set up the board with default starting position.\n");
   printf("            endgame:       set up the board with endgame configuration.\n");
@@ -264,6 +549,7 @@ void help()  {
   printf("            Use the comment \"uci\" to see possible options and their current values\n");
   printf("            Sample usage: \n");
   printf("                setoption name fut_depth value 4: set fut_depth to 4\n");
+  printf("stop      - End a \"go ponder\" search, which then answers bestmove.\n");
   printf("uci       - Display UCI version and options\n");
   printf("\n");
 }
@@ -373,6 +659,8 @@ void print_options() {
 
 int main(int argc, char *argv[]) {
   position_t* gme = (position_t*) malloc(sizeof(position_t) * MAX_PLY_IN_GAME);
+  // gme_undo[i] takes gme[i] back to gme[i-1], and is its history
+  undo_t* gme_undo = (undo_t*) malloc(sizeof(undo_t) * MAX_PLY_IN_GAME);
 
   setbuf(stdout, NULL);
   setbuf(stdin, NULL);
@@ -381,6 +669,7 @@ int main(int argc, char *argv[]) {
 
   init_options();
   init_zob();
+  init_eval();
 
   char** tok = (char**) malloc(sizeof(char*) * MAX_CHARS_IN_TOKEN * MAX_PLY_IN_GAME);
   int   ix = 0;  // index of which position we are operating on
@@ -390,6 +679,8 @@ int main(int argc, char *argv[]) {
   char* istr = (char*) malloc(sizeof(char) * 24000);
 
   tt_make_hashtable(HASH);   // initial hash table
+  eval_cache_resize(EVAL_CACHE);
+  init_threads(THREADS);     // initial number of search workers
   fen_to_pos(&gme[ix], "");  // initialize with an actual position
 
   while (true) {
@@ -402,6 +693,22 @@ int main(int argc, char *argv[]) {
         continue;
       }
 
+      // A ponder search runs on through isready, ends at ponderhit or
+      // stop, and is ended by anything else before it is done.
+      if (ponder_running && strcmp(tok[0], "isready") != 0 &&
+          strcmp(tok[0], "ponderhit") != 0) {
+        ponder_finish(strcmp(tok[0], "stop") == 0);
+      }
+
+      if (strcmp(tok[0], "ponderhit") == 0) {
+        ponder_hit();
+        continue;
+      }
+
+      if (strcmp(tok[0], "stop") == 0) {  // nothing left to stop
+        continue;
+      }
+
       if (strcmp(tok[0], "quit") == 0) {
         break;
       }
@@ -434,7 +741,7 @@ int main(int argc, char *argv[]) {
         int save_ix = ix;
         if (token_count > n+1) {
           for (int j = n + 1; j < token_count; j++) {
-            piece_t victim = make_from_string(&gme[ix], &gme[ix+1], tok[j]);
+            piece_t victim = make_from_string(&gme[ix], &gme[ix+1], &gme_undo[ix+1], tok[j]);
             if (victim < 0) {
               fprintf(OUT, "info string Move %s is illegal\n", tok[j]);
               ix = save_ix;
@@ -451,7 +758,7 @@ int main(int argc, char *argv[]) {
       }
 
       if (strcmp(tok[0], "move") == 0) {
-        piece_t victim = make_from_string(&gme[ix], &gme[ix+1], tok[1]);
+        piece_t victim = make_from_string(&gme[ix], &gme[ix+1], &gme_undo[ix+1], tok[1]);
         if (token_count < 2) {  // no input
           fprintf(OUT, "Second argument (move positon) required.\n");
           continue;
@@ -538,14 +845,24 @@ int main(int argc, char *argv[]) {
               printf("info setting %s to %d\n", iopts[j].name, v);
               *(iopts[j].var) = v;
 
-              if (strcmp(name+1, "hash") == 0) {
+              if (strcmp(name+1, "hash") == 0 ||
+                  strcmp(name+1, "huge_pages") == 0) {
                 tt_resize_hashtable(HASH);
-                printf("info string Hash table set to %d records of "
+                printf("info string Hash table set to %" PRIu64 " records of "
                        "%zu bytes each\n",
                        tt_get_num_of_records(), tt_get_bytes_per_record());
-                printf("info string Total hash table size: %zu bytes\n",
+                printf("info string Total hash table size: %" PRIu64 " bytes\n",
                        tt_get_num_of_records() * tt_get_bytes_per_record());
               }
+              if (strcmp(name+1, "eval_cache") == 0) {
+                eval_cache_resize(EVAL_CACHE);
+              } else {
+                eval_cache_clear();  // cached scores used the old weights
+              }
+              if (strcmp(name+1, "threads") == 0) {
+                init_threads(THREADS);
+                printf("info string Search set to %d threads\n", THREADS);
+              }
               break;
             }
           }
@@ -583,7 +900,7 @@ int main(int argc, char *argv[]) {
           score_t score = eval(&gme[ix], true);
           fprintf(OUT, "info score cp %d\n", score);
         } else {  // get and evaluate move
-          piece_t victim = make_from_string(&gme[ix], &gme[ix+1], tok[1]);
+          piece_t victim = make_from_string(&gme[ix], &gme[ix+1], &gme_undo[ix+1], tok[1]);
           if (victim == KO) {
             printf("Illegal move\n");
           } else {
@@ -600,6 +917,7 @@ int main(int argc, char *argv[]) {
         double inc = 0.0;
         int    depth = INF_DEPTH; 
         double goal = INF_TIME;
+        bool   ponder = false;
 
         // process various tokens here
         for (int n = 1; n < token_count; n++) {
@@ -618,18 +936,24 @@ int main(int argc, char *argv[]) {
             inc = strtod(tok[n], (char **)NULL);
             continue;
           }
+          if (strcmp(tok[n], "ponder") == 0) {
+            ponder = true;
+            continue;
+          }
         }
 
-        if (depth < INF_DEPTH) {
-          UciBeginSearch( &gme[ix], depth, INF_TIME );
-        } else {
+        if (depth == INF_DEPTH) {
           goal = tme * 0.02;  // use about 1/50 of main time 
           goal += inc * 0.80; // use most of increment
           // sanity check,  make sure that we don't run ourselves too low
           if (goal*10 > tme) goal = tme / 10.0;   
+        }
 
-          UciBeginSearch( &gme[ix], INF_DEPTH, goal );
-        } 
+        if (ponder) {
+          ponder_start( &gme[ix], depth, goal );
+        } else {
+          UciBeginSearch( &gme[ix], depth, goal );
+        }
         continue;
       }
 
@@ -644,7 +968,58 @@ int main(int argc, char *argv[]) {
         if (token_count >= 2) {  // Takes a depth argument to test deeper
           depth = strtol(tok[1], (char **)NULL, 10);
         }
-        do_perft(gme, depth, 0);
+        if (token_count >= 4 && strcmp(tok[2], "threads") == 0) {
+          int threads = strtol(tok[3], (char **)NULL, 10);
+          if (threads < 1) threads = 1;
+          if (threads > MAX_THREADS) threads = MAX_THREADS;
+          init_threads(threads);
+          do_perft_divide(gme, depth, HASH);
+          init_threads(THREADS);
+        } else {
+          do_perft(gme, depth, 0);
+        }
+        continue;
+      }
+
+      if (strcmp(tok[0], "bench") == 0) {  // Fixed positions, fixed depth
+        int depth = BENCH_DEPTH;
+        if (token_count >= 2) {
+          depth = strtol(tok[1], (char **)NULL, 10);
+          if (depth < 1) depth = 1;
+        }
+        bench(depth);
+        continue;
+      }
+
+      if (strcmp(tok[0], "kbench") == 0) {  // Time the hot kernels
+        int samples = 15;
+        if (token_count >= 2) {
+          samples = strtol(tok[1], (char **)NULL, 10);
+          if (samples < 1) samples = 1;
+        }
+        kernel_bench(samples);
+        continue;
+      }
+
+      if (strcmp(tok[0], "ttbench") == 0) { // Time hash table prefetching
+        int iterations = 1000000;
+        if (token_count >= 2) {
+          iterations = strtol(tok[1], (char **)NULL, 10);
+          if (iterations < 1) iterations = 1;
+        }
+        tt_prefetch_bench(&gme[ix], iterations);
+        continue;
+      }
+
+      if (strcmp(tok[0], "ttstress") == 0) { // Test lockless hash table
+        int num_threads = 4;
+        if (token_count >= 2) {
+          num_threads = strtol(tok[1], (char **)NULL, 10);
+          if (num_threads < 1) num_threads = 1;
+        }
+        uint64_t torn = tt_stress_test(num_threads, 1000000);
+        printf("info string tt stress test %s: %" PRIu64 " torn records\n",
+               torn == 0 ? "passed" : "FAILED", torn);
         continue;
       }
 
@@ -652,6 +1027,7 @@ int main(int argc, char *argv[]) {
       continue;
     }
   }
+  ponder_finish(true);
   tt_free_hashtable();
 
   return 0;
@@ -24,14 +24,19 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <algorithm>
 
+#include <cilk/cilk.h>
+
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
 
 #include "fen.h"
 #include "move_gen.h"
 #include "search.h"
+#include "stats.h"
+#include "tt.h"
 #include "util.h"
 
 #define MAX(x, y)  ((x) > (y) ? (x) : (y))
@@ -100,6 +105,68 @@ char *nesw_to_str[NUM_ORIENTATION] = {"north", "east", "south", "west"};
 static uint64_t   zob[ARR_SIZE][1<<PIECE_SIZE];
 static uint64_t   zob_color;
 
+#define SQ_OF(f, r) (ARR_WIDTH * (FIL_ORIGIN + (f)) + RNK_ORIGIN + (r))
+#define BB_ONE ((bitboard_t) 1)
+// bits 0 to n - 1
+#define BB_BELOW(n) ((BB_ONE << (n)) - 1)
+// the first bit of every file: the sum of 2^(f * BOARD_WIDTH)
+#define BB_FILE_STARTS \
+  (BB_BELOW(BOARD_WIDTH * BOARD_WIDTH) / BB_BELOW(BOARD_WIDTH))
+
+// file and rank of an on-board square, 0 and 0 off the board
+#define SQ_BB_FIL(sq) (sq_info<(sq)>::bit / BOARD_WIDTH)
+#define SQ_BB_RNK(sq) (sq_info<(sq)>::bit % BOARD_WIDTH)
+
+#define SQUARE_BB_ENTRY(a, sq) \
+  ((bitboard_t) sq_info<(sq)>::on_board << sq_info<(sq)>::bit)
+#define BIT_SQUARE_ENTRY(a, i) \
+  ((i) < BOARD_WIDTH * BOARD_WIDTH ? \
+   SQ_OF((i) / BOARD_WIDTH, (i) % BOARD_WIDTH) : 0)
+
+// a ray runs from the square next to (f, r) to the edge of the board
+#define RAY_NN(f, r) (BB_BELOW(BOARD_WIDTH - 1 - (r)) << ((f) * BOARD_WIDTH + (r) + 1))
+#define RAY_EE(f, r) ((BB_FILE_STARTS << (r)) & ~BB_BELOW(((f) + 1) * BOARD_WIDTH))
+#define RAY_SS(f, r) (BB_BELOW(r) << ((f) * BOARD_WIDTH))
+#define RAY_WW(f, r) ((BB_FILE_STARTS << (r)) & BB_BELOW((f) * BOARD_WIDTH))
+#define RAY_ENTRY(a, sq)                                              \
+  { sq_info<(sq)>::on_board ? RAY_NN(SQ_BB_FIL(sq), SQ_BB_RNK(sq)) : 0, \
+    sq_info<(sq)>::on_board ? RAY_EE(SQ_BB_FIL(sq), SQ_BB_RNK(sq)) : 0, \
+    sq_info<(sq)>::on_board ? RAY_SS(SQ_BB_FIL(sq), SQ_BB_RNK(sq)) : 0, \
+    sq_info<(sq)>::on_board ? RAY_WW(SQ_BB_FIL(sq), SQ_BB_RNK(sq)) : 0 }
+
+const bitboard_t square_bbs[SQ_TABLE_SIZE] CACHE_LINE_ALIGNMENT = {
+  SQ_TABLE(SQUARE_BB_ENTRY)
+};
+const square_t bit_squares[SQ_TABLE_SIZE] CACHE_LINE_ALIGNMENT = {
+  SQ_TABLE(BIT_SQUARE_ENTRY)
+};
+const bitboard_t ray_bbs[SQ_TABLE_SIZE][NUM_ORIENTATION] CACHE_LINE_ALIGNMENT = {
+  SQ_TABLE(RAY_ENTRY)
+};
+
+#ifdef BITBOARD
+// the masks must agree with board[]
+static inline bool bitboards_consistent(position_t *p) {
+  bitboard_t occupied = 0, pawns = 0, colors[2] = {0, 0};
+  for (fil_t f = 0; f < BOARD_WIDTH; f++) {
+    for (rnk_t r = 0; r < BOARD_WIDTH; r++) {
+      square_t sq = square_of(f, r);
+      piece_t x = p->board[sq];
+      if (ptype_of(x) == EMPTY) {
+        continue;
+      }
+      occupied |= square_bbs[sq];
+      colors[color_of(x)] |= square_bbs[sq];
+      if (ptype_of(x) == PAWN) {
+        pawns |= square_bbs[sq];
+      }
+    }
+  }
+  return occupied == p->occupied && pawns == p->pawn_bb &&
+         colors[WHITE] == p->color_bb[WHITE] &&
+         colors[BLACK] == p->color_bb[BLACK];
+}
+#else
 static inline void check_bit_row_and_column(position_t * p) {
   for (int i = 0; i < BOARD_WIDTH; i++) {
     uint16_t column = 0;
@@ -128,6 +195,8 @@ static inline void check_bit_row_and_column(position_t * p) {
   }
 }
 
+#endif
+
 // Zobrist
 uint64_t compute_zob_key(position_t *p) {
   uint64_t key = 0;
@@ -182,6 +251,21 @@ int dir_of(int i) {
   return dir[i];
 }
 
+// For each square, the mask of the directions that stay on the board: bit
+// d is set if sq + dir[d] is on it.  A piece may move onto any square next
+// to it, so these are its moves.
+#define DIR_BIT(sq, d, delta) (sq_info<(sq) + (delta)>::on_board << (d))
+#define MOVE_DIRS_ENTRY(a, sq)                                            \
+  (sq_info<(sq)>::on_board ?                                              \
+   DIR_BIT(sq, 0, -ARR_WIDTH - 1) | DIR_BIT(sq, 1, -ARR_WIDTH) |          \
+   DIR_BIT(sq, 2, -ARR_WIDTH + 1) | DIR_BIT(sq, 3, -1) |                  \
+   DIR_BIT(sq, 4, 1) | DIR_BIT(sq, 5, ARR_WIDTH - 1) |                    \
+   DIR_BIT(sq, 6, ARR_WIDTH) | DIR_BIT(sq, 7, ARR_WIDTH + 1) : 0)
+
+static const unsigned char move_dirs[SQ_TABLE_SIZE] CACHE_LINE_ALIGNMENT = {
+  SQ_TABLE(MOVE_DIRS_ENTRY)
+};
+
 // converts a move to string notation for FEN
 void move_to_str(move_t mv, char *buf) {
   square_t f = from_square(mv);  // from-square
@@ -324,11 +408,49 @@ inline void generate_single_piece_move(ptype_t typ, square_t sq, int &move_count
     assert(move_count < MAX_NUM_MOVES);
 }
 
+#ifdef BITBOARD
+// generate_single_piece_move from move_dirs instead of board[]: each
+// direction's move is written, and kept if its bit is set.  The list has
+// room for the moves not kept, since a piece has at most 8 + 3 moves and
+// the count is checked below MAX_NUM_MOVES after each piece.
+static inline void generate_masked_piece_move(ptype_t typ, square_t sq,
+                                              int &move_count,
+                                              sortable_move_t *sortable_move_list) {
+  int dirs = move_dirs[sq];
+  assert(dirs != 0);
+#define MASKED_MOVE(d, delta)                                           \
+  sortable_move_list[move_count] = move_of(typ, (rot_t) 0, sq, sq + (delta)); \
+  move_count += (dirs >> (d)) & 1;
+  MASKED_MOVE(0, -ARR_WIDTH - 1);
+  MASKED_MOVE(1, -ARR_WIDTH);
+  MASKED_MOVE(2, -ARR_WIDTH + 1);
+  MASKED_MOVE(3, -1);
+  MASKED_MOVE(4, 1);
+  MASKED_MOVE(5, ARR_WIDTH - 1);
+  MASKED_MOVE(6, ARR_WIDTH);
+  MASKED_MOVE(7, ARR_WIDTH + 1);
+#undef MASKED_MOVE
+  sortable_move_list[move_count++] = move_of(typ, (rot_t) 1, sq, sq);
+  sortable_move_list[move_count++] = move_of(typ, (rot_t) 2, sq, sq);
+  sortable_move_list[move_count++] = move_of(typ, (rot_t) 3, sq, sq);
+  assert(move_count < MAX_NUM_MOVES);
+}
+#endif
+
 int generate_all(position_t *p, sortable_move_t *sortable_move_list) {
   color_t ctm = color_to_move_of(p);
   int move_count = 0;
   // Generate kings move
   square_t sq = p->king_locs[ctm];
+#ifdef BITBOARD
+  generate_masked_piece_move(KING, sq, move_count, sortable_move_list);
+  sortable_move_list[move_count++] = move_of(KING, (rot_t) 0, sq, sq); // Also generate null move
+  for (bitboard_t pawns = p->color_bb[ctm] & p->pawn_bb; pawns;
+       pawns &= pawns - 1) {
+    generate_masked_piece_move(PAWN, bb_first_square(pawns), move_count,
+                               sortable_move_list);
+  }
+#else
   generate_single_piece_move(KING, sq, move_count, p, sortable_move_list);
   assert(move_count < MAX_NUM_MOVES);
   sortable_move_list[move_count++] = move_of(KING, (rot_t) 0, sq, sq); // Also generate null move
@@ -337,6 +459,143 @@ int generate_all(position_t *p, sortable_move_t *sortable_move_list) {
     generate_single_piece_move(PAWN, sq, move_count, p, sortable_move_list);
     i++; 
   }
+#endif
+  return move_count;
+}
+
+// Moves of the piece on sq onto the squares in onto, and its rotations
+// if rotations is set
+static inline void generate_piece_moves_onto(ptype_t typ, square_t sq,
+                                             bitboard_t onto, bool rotations,
+                                             int &move_count,
+                                             sortable_move_t *sortable_move_list) {
+  for (int d = 0; d < 8; d++) {
+    int dest = sq + dir_of(d);
+    if (square_bbs[dest] & onto) {
+      sortable_move_list[move_count++] = move_of(typ, (rot_t) 0, sq, dest);
+    }
+  }
+  if (rotations) {
+    sortable_move_list[move_count++] = move_of(typ, (rot_t) 1, sq, sq);
+    sortable_move_list[move_count++] = move_of(typ, (rot_t) 2, sq, sq);
+    sortable_move_list[move_count++] = move_of(typ, (rot_t) 3, sq, sq);
+  }
+  assert(move_count < MAX_NUM_MOVES);
+}
+
+// p->laser[c], traced if it is stale
+static inline laser_cache_t *fresh_laser(position_t *p, color_t c) {
+  laser_cache_t *lc = &p->laser[c];
+  if (lc->key != p->key) {
+    trace_laser(p, c, NULL);
+  }
+  return lc;
+}
+
+// The capture-candidate filter: true if mv is among generate_moves'
+// LASER_MOVES, the only moves that may zap an enemy piece.  Lets
+// quiescence pass over a move before making it.
+bool is_laser_move(position_t *p, move_t mv) {
+  color_t ctm = color_to_move_of(p);
+  laser_cache_t *lc = fresh_laser(p, ctm);
+  if (lc->victim != 0 && color_of(p->board[lc->victim]) != ctm) {
+    return true;
+  }
+  return ((square_bbs[from_square(mv)] | square_bbs[to_square(mv)]) &
+          lc->lit) != 0;
+}
+
+// generate_moves for the pawn on sq: all its moves if it is on the path,
+// else its moves onto the squares in onto
+static inline void generate_pawn_stage(position_t *p, square_t sq,
+                                       bitboard_t lit, bitboard_t onto,
+                                       move_stage_t stage, int &move_count,
+                                       sortable_move_t *sortable_move_list) {
+  if (square_bbs[sq] & lit) {
+    if (stage == LASER_MOVES) {
+      generate_single_piece_move(PAWN, sq, move_count, p, sortable_move_list);
+    }
+  } else {
+    generate_piece_moves_onto(PAWN, sq, onto, stage == QUIET_MOVES,
+                              move_count, sortable_move_list);
+  }
+}
+
+#ifndef NDEBUG
+// true if none of the moves zaps an enemy piece
+static bool moves_are_quiet(position_t *p, sortable_move_t *sortable_move_list,
+                            int move_count) {
+  color_t ctm = color_to_move_of(p);
+  for (int i = 0; i < move_count; i++) {
+    position_t np = *p;
+    undo_t undo;
+    piece_t victim = make_move(&np, get_move(sortable_move_list[i]), &undo);
+    if (victim > 0 && color_of(victim) != ctm) {
+      return false;
+    }
+  }
+  return true;
+}
+#endif
+
+#ifndef NDEBUG
+// true if is_laser_move agrees with the stage the moves were generated in
+static bool moves_in_stage(position_t *p, sortable_move_t *sortable_move_list,
+                           int move_count, move_stage_t stage) {
+  for (int i = 0; i < move_count; i++) {
+    move_t mv = get_move(sortable_move_list[i]);
+    if (is_laser_move(p, mv) != (stage == LASER_MOVES)) {
+      return false;
+    }
+  }
+  return true;
+}
+#endif
+
+// Generates the moves of one stage: LASER_MOVES, those that may let the
+// mover's laser zap an enemy piece, or QUIET_MOVES, the rest.  Together
+// they are generate_all's moves.  A move only changes the squares it
+// leaves and enters, so unless one of them is lit the laser zaps what it
+// zaps now.  If that is an enemy piece every move is a LASER_MOVE;
+// otherwise only the king's moves and those of pawns on or onto the path
+// are.
+int generate_moves(position_t *p, sortable_move_t *sortable_move_list,
+                   move_stage_t stage) {
+  color_t ctm = color_to_move_of(p);
+  laser_cache_t *lc = fresh_laser(p, ctm);
+  if (lc->victim != 0 && color_of(p->board[lc->victim]) != ctm) {
+    return stage == LASER_MOVES ? generate_all(p, sortable_move_list) : 0;
+  }
+
+  int move_count = 0;
+  square_t sq = p->king_locs[ctm];
+  if (stage == LASER_MOVES) {
+    generate_single_piece_move(KING, sq, move_count, p, sortable_move_list);
+    sortable_move_list[move_count++] = move_of(KING, (rot_t) 0, sq, sq);
+  }
+
+  // the squares a pawn off the path moves onto in this stage
+  bitboard_t onto = stage == LASER_MOVES ?
+      lc->lit : BB_BELOW(BOARD_WIDTH * BOARD_WIDTH) & ~lc->lit;
+#ifdef BITBOARD
+  bitboard_t pawns = p->color_bb[ctm] & p->pawn_bb;
+  while (pawns) {
+    sq = bb_first_square(pawns);
+    generate_pawn_stage(p, sq, lc->lit, onto, stage, move_count,
+                        sortable_move_list);
+    pawns &= pawns - 1;
+  }
+#else
+  int i = 0;
+  while (sq = p->pawns_locs[ctm][i]) {
+    generate_pawn_stage(p, sq, lc->lit, onto, stage, move_count,
+                        sortable_move_list);
+    i++;
+  }
+#endif
+  assert(stage == LASER_MOVES ||
+         moves_are_quiet(p, sortable_move_list, move_count));
+  assert(moves_in_stage(p, sortable_move_list, move_count, stage));
   return move_count;
 }
 
@@ -392,7 +651,108 @@ int generate_all_test(position_t *p, sortable_move_t *sortable_move_list,
 
 
 
-inline void low_level_make_move(position_t *previous, position_t *next, move_t mv) {
+// true if sq lies in the rectangle with corners a and b
+static inline bool in_rect(square_t sq, square_t a, square_t b) {
+  fil_t f = fil_of(sq);
+  rnk_t r = rnk_of(sq);
+  fil_t af = fil_of(a);
+  fil_t bf = fil_of(b);
+  rnk_t ar = rnk_of(a);
+  rnk_t br = rnk_of(b);
+  return f >= MIN(af, bf) && f <= MAX(af, bf) &&
+         r >= MIN(ar, br) && r <= MAX(ar, br);
+}
+
+// true if sq lies in the rectangle with the kings at its corners
+static inline bool in_king_rect(position_t *p, square_t sq) {
+  return in_rect(sq, p->king_locs[WHITE], p->king_locs[BLACK]);
+}
+
+// counts each color's pawns, and those in the rectangle with corners a
+// and b
+static void count_pawns_into(position_t *p, square_t a, square_t b,
+                             int count[2], int between[2]) {
+#ifdef BITBOARD
+  fil_t f0 = fil_of(a), f1 = fil_of(b);
+  rnk_t r0 = rnk_of(a), r1 = rnk_of(b);
+  if (f0 > f1) {
+    std::swap(f0, f1);
+  }
+  if (r0 > r1) {
+    std::swap(r0, r1);
+  }
+  // files f0..f1 are a contiguous run of bits, and the same run of ranks
+  // repeats in every file
+  bitboard_t rank_bits = (1 << (r1 + 1)) - (1 << r0);
+  bitboard_t file_starts = 0;
+  for (fil_t f = f0; f <= f1; f++) {
+    file_starts |= ((bitboard_t) 1) << (f * BOARD_WIDTH);
+  }
+  bitboard_t rect = rank_bits * file_starts;
+  for (int c = 0; c < 2; c++) {
+    bitboard_t pawns = p->color_bb[c] & p->pawn_bb;
+    count[c] = bb_popcount(pawns);
+    between[c] = bb_popcount(pawns & rect);
+  }
+#else
+  for (int c = 0; c < 2; c++) {
+    count[c] = 0;
+    between[c] = 0;
+    square_t sq;
+    for (int i = 0; (sq = p->pawns_locs[c][i]); i++) {
+      count[c]++;
+      between[c] += in_rect(sq, a, b);
+    }
+  }
+#endif
+}
+
+// Recounts p->pawn_count and p->pawns_between from scratch.
+void count_pawns(position_t *p) {
+  count_pawns_into(p, p->king_locs[WHITE], p->king_locs[BLACK],
+                   p->pawn_count, p->pawns_between);
+}
+
+// Counts each color's pawns that would be between the kings if they
+// stood on a and b instead.
+void count_pawns_between(position_t *p, square_t a, square_t b,
+                         int between[2]) {
+  int count[2];
+  count_pawns_into(p, a, b, count, between);
+}
+
+static inline bool pawn_counts_consistent(position_t *p) {
+  int count[2], between[2];
+  count_pawns_into(p, p->king_locs[WHITE], p->king_locs[BLACK], count, between);
+  return count[WHITE] == p->pawn_count[WHITE] &&
+         count[BLACK] == p->pawn_count[BLACK] &&
+         between[WHITE] == p->pawns_between[WHITE] &&
+         between[BLACK] == p->pawns_between[BLACK];
+}
+
+// Carries each color's laser cache from the position keyed old_key to p,
+// which differs from it on the squares in touched.  A laser that lights
+// none of them is unchanged, and so is its h_attackable sum unless the
+// other king is among the moved_kings (one bit per color).
+static inline void carry_lasers(position_t *p, uint64_t old_key,
+                                bitboard_t touched, int moved_kings) {
+  for (int c = 0; c < 2; c++) {
+    laser_cache_t *lc = &p->laser[c];
+    if (lc->lit & touched) {
+      continue;
+    }
+    if (lc->key == old_key) {
+      lc->key = p->key;
+    }
+    if (lc->h_key == old_key && !(moved_kings & (1 << opp_color((color_t) c)))) {
+      lc->h_key = p->key;
+    }
+  }
+}
+
+// Makes mv on p in place, saving in *undo what unmake_move needs to take it
+// back.  Does not fire the laser.
+inline void low_level_make_move(position_t *p, move_t mv, undo_t *undo) {
   assert(mv != 0);
   
   WHEN_DEBUG_VERBOSE( char buf[MAX_CHARS_IN_MOVE]; );
@@ -401,11 +761,11 @@ inline void low_level_make_move(position_t *previous, position_t *next, move_t m
       DEBUG_LOG(1, "low_level_make_move: %s\n", buf);
     });
   
-  assert(previous->key == compute_zob_key(previous));
+  assert(p->key == compute_zob_key(p));
 
   WHEN_DEBUG_VERBOSE({
     fprintf(stderr, "Before:\n");
-    display(previous);
+    display(p);
   })
 
   square_t from_sq = from_square(mv);
@@ -437,49 +797,74 @@ inline void low_level_make_move(position_t *previous, position_t *next, move_t m
     }
   })
 
-  *next = *previous;
-
-  next->history = previous;
-  next->last_move = mv;
+  undo->key = p->key;
+  undo->last_move = p->last_move;
+  undo->victim = p->victim;
+  undo->king_locs[WHITE] = p->king_locs[WHITE];
+  undo->king_locs[BLACK] = p->king_locs[BLACK];
+  undo->history = p->history;
+  undo->victim_sq = 0;
+  undo->laser[WHITE] = p->laser[WHITE];
+  undo->laser[BLACK] = p->laser[BLACK];
+  undo->pawn_count[WHITE] = p->pawn_count[WHITE];
+  undo->pawn_count[BLACK] = p->pawn_count[BLACK];
+  undo->pawns_between[WHITE] = p->pawns_between[WHITE];
+  undo->pawns_between[BLACK] = p->pawns_between[BLACK];
+#ifndef BITBOARD
+  memcpy(undo->pawns_locs, p->pawns_locs, sizeof(p->pawns_locs));
+#endif
+
+  p->history = undo;
+  p->last_move = mv;
 
   assert(from_sq < ARR_SIZE && from_sq > 0);
-  assert(next->board[from_sq] < (1 << PIECE_SIZE) &&
-         next->board[from_sq] >= 0);
+  assert(p->board[from_sq] < (1 << PIECE_SIZE) &&
+         p->board[from_sq] >= 0);
   assert(to_sq < ARR_SIZE && to_sq > 0);
-  assert(next->board[to_sq] < (1 << PIECE_SIZE) &&
-         next->board[to_sq] >= 0);
+  assert(p->board[to_sq] < (1 << PIECE_SIZE) &&
+         p->board[to_sq] >= 0);
 
-  next->key ^= zob_color;   // swap color to move
+  p->key ^= zob_color;   // swap color to move
 
-  piece_t from_piece = next->board[from_sq];
-  piece_t to_piece = next->board[to_sq];
+  piece_t from_piece = p->board[from_sq];
+  piece_t to_piece = p->board[to_sq];
+  undo->from_piece = from_piece;
+  undo->to_piece = to_piece;
 
   if (to_sq != from_sq) {  // move, not rotation
-    next->board[to_sq] = from_piece;  // swap from_piece and to_piece on board
-    next->board[from_sq] = to_piece;
+    p->board[to_sq] = from_piece;  // swap from_piece and to_piece on board
+    p->board[from_sq] = to_piece;
 
     // Hash key updates
-    next->key ^= zob[from_sq][from_piece];  // remove from_piece from from_sq
-    next->key ^= zob[to_sq][to_piece];  // remove to_piece from to_sq
-    next->key ^= zob[to_sq][from_piece];  // place from_piece in to_sq
-    next->key ^= zob[from_sq][to_piece];  // place to_piece in from_sq
+    p->key ^= zob[from_sq][from_piece];  // remove from_piece from from_sq
+    p->key ^= zob[to_sq][to_piece];  // remove to_piece from to_sq
+    p->key ^= zob[to_sq][from_piece];  // place from_piece in to_sq
+    p->key ^= zob[from_sq][to_piece];  // place to_piece in from_sq
 
     color_t from_piece_color = color_of(from_piece);
     color_t to_piece_color = color_of(to_piece);
     // Update King locations if necessary
     if (ptype_of(from_piece) == KING) {
-      next->king_locs[from_piece_color] = to_sq;
+      p->king_locs[from_piece_color] = to_sq;
     }
     if (ptype_of(to_piece) == KING) {
-      next->king_locs[to_piece_color] = from_sq;
+      p->king_locs[to_piece_color] = from_sq;
     }
+#ifdef BITBOARD
+    bb_toggle(p, from_sq, from_piece);
+    bb_toggle(p, to_sq, from_piece);
+    if (ptype_of(to_piece) != EMPTY) {
+      bb_toggle(p, to_sq, to_piece);
+      bb_toggle(p, from_sq, to_piece);
+    }
+#else
     // Update Pawns location if neccessary
     if (ptype_of(from_piece) == PAWN) {
       int i = 0;
       square_t sq;
-      while (sq = next->pawns_locs[from_piece_color][i]) {
+      while (sq = p->pawns_locs[from_piece_color][i]) {
         if (sq == from_sq) {
-          next->pawns_locs[from_piece_color][i] = to_sq;
+          p->pawns_locs[from_piece_color][i] = to_sq;
           break;
         }
         i++;
@@ -488,9 +873,9 @@ inline void low_level_make_move(position_t *previous, position_t *next, move_t m
     if (ptype_of(to_piece) == PAWN) {
       int i = 0;
       square_t sq;
-      while (sq = next->pawns_locs[to_piece_color][i]) {
+      while (sq = p->pawns_locs[to_piece_color][i]) {
         if (sq == to_sq) {
-          next->pawns_locs[to_piece_color][i] = from_sq;
+          p->pawns_locs[to_piece_color][i] = from_sq;
           break;
         }
         i++;
@@ -504,8 +889,21 @@ inline void low_level_make_move(position_t *previous, position_t *next, move_t m
       rnk_t to_r = rnk_of(to_sq);
       fil_t from_f = fil_of(from_sq);
       fil_t to_f = fil_of(to_sq);
-      reset_bit(next, from_f, from_r);
-      set_bit(next, to_f, to_r);
+      reset_bit(p, from_f, from_r);
+      set_bit(p, to_f, to_r);
+    }
+#endif
+
+    if (ptype_of(from_piece) == KING || ptype_of(to_piece) == KING) {
+      count_pawns(p);  // the rectangle moved
+    } else {
+      // a pawn moved, swapping places with whatever was on to_sq
+      p->pawns_between[from_piece_color] +=
+          in_king_rect(p, to_sq) - in_king_rect(p, from_sq);
+      if (ptype_of(to_piece) == PAWN) {
+        p->pawns_between[to_piece_color] +=
+            in_king_rect(p, from_sq) - in_king_rect(p, to_sq);
+      }
     }
     //std::cout<<"\nChecking after piece move.";
     //check_bit_row_and_column(next);
@@ -514,25 +912,39 @@ inline void low_level_make_move(position_t *previous, position_t *next, move_t m
   } else {  // rotation
 
     // remove from_piece from from_sq in hash
-    next->key ^= zob[from_sq][from_piece];
+    p->key ^= zob[from_sq][from_piece];
     set_ori(&from_piece, rot + orientation_of(from_piece));  // rotate from_piece
-    next->board[from_sq] = from_piece;  // place rotated piece on board
-    next->key ^= zob[from_sq][from_piece];              // ... and in hash
+    p->board[from_sq] = from_piece;  // place rotated piece on board
+    p->key ^= zob[from_sq][from_piece];              // ... and in hash
     //std::cout<<"\nChecking after piece rotation.";
     //check_bit_row_and_column(next);
   }
 
   // Increment ply
-  next->ply++;
+  p->ply++;
 
-  assert(next->key == compute_zob_key(next));
+  int moved_kings = 0;
+  for (int c = 0; c < 2; c++) {
+    if (p->king_locs[c] != undo->king_locs[c]) {
+      moved_kings |= 1 << c;
+    }
+  }
+  carry_lasers(p, undo->key, square_bbs[from_sq] | square_bbs[to_sq],
+               moved_kings);
+
+  assert(p->key == compute_zob_key(p));
+  assert(pawn_counts_consistent(p));
+#ifdef BITBOARD
+  assert(bitboards_consistent(p));
+#endif
 
   WHEN_DEBUG_VERBOSE({
     fprintf(stderr, "After:\n");
-    display(next);
+    display(p);
   })
 }
 
+#ifndef BITBOARD
 static inline void check_pawns_locs_invariant(position_t * next) {
   for (int c = 0; c < 2; c++) {
     assert(next->pawns_locs[c][PAWNS_COUNT] == 0); // The end of pawns_locs is a sentinel
@@ -568,138 +980,125 @@ static inline void check_pawns_locs_invariant(position_t * next) {
   }
 }
 
-// returns square of piece to be removed from board or 0
-square_t fire(position_t *p) {
-  color_t fctm = (color_to_move_of(p) == WHITE) ? BLACK : WHITE;
-  square_t sq = p->king_locs[fctm];
+#endif
+
+// beam_turn[bdir][piece]: direction of the beam after it hits piece, or -1
+// if it stops there (a king or the back of a pawn)
+#define BEAM_TURN_ENTRY(bdir, x)                          \
+  ((((x) >> PTYPE_SHIFT) & PTYPE_MASK) == PAWN ?          \
+   REFLECT(bdir, ((x) >> ORIENTATION_SHIFT) & ORIENTATION_MASK) : -1)
+#define BEAM_TURN_ROW(bdir) \
+  { TABLE_REP16(BEAM_TURN_ENTRY, bdir, 0), TABLE_REP16(BEAM_TURN_ENTRY, bdir, 16) }
+typedef char pieces_fit_beam_turn[(1 << PIECE_SIZE) == 32 ? 1 : -1];
+
+static const int beam_turn[NUM_ORIENTATION][1 << PIECE_SIZE] CACHE_LINE_ALIGNMENT = {
+  BEAM_TURN_ROW(NN), BEAM_TURN_ROW(EE), BEAM_TURN_ROW(SS), BEAM_TURN_ROW(WW)
+};
+
+// ray_end[sq][bdir]: last square on the board from sq in direction bdir,
+// or sq itself on the edge
+#define RAY_END_ENTRY(a, sq)                                             \
+  { sq_info<(sq)>::on_board ? SQ_OF(SQ_BB_FIL(sq), BOARD_WIDTH - 1) : 0, \
+    sq_info<(sq)>::on_board ? SQ_OF(BOARD_WIDTH - 1, SQ_BB_RNK(sq)) : 0, \
+    sq_info<(sq)>::on_board ? SQ_OF(SQ_BB_FIL(sq), 0) : 0,               \
+    sq_info<(sq)>::on_board ? SQ_OF(0, SQ_BB_RNK(sq)) : 0 }
+
+static const square_t ray_end[SQ_TABLE_SIZE][NUM_ORIENTATION] CACHE_LINE_ALIGNMENT = {
+  SQ_TABLE(RAY_END_ENTRY)
+};
+
+#ifdef BITBOARD
+// first piece past sq in direction bdir, or 0: the lowest bit of the ray
+// going north or east, the highest going south or west
+static inline square_t next_on_beam(position_t *p, square_t sq, int bdir) {
+  bitboard_t blockers = p->occupied & ray_bbs[sq][bdir];
+  if (blockers == 0) {
+    return 0;
+  }
+  return bit_squares[bdir < 2 ? bb_lsb(blockers) : bb_msb(blockers)];
+}
+#else
+// first piece past sq in direction bdir, or 0.  Shifting sq and everything
+// behind it out of the rank or file vector leaves the nearest piece at the
+// top (north, east) or bottom (south, west) of what remains.
+static inline square_t next_on_beam(position_t *p, square_t sq, int bdir) {
   rnk_t r = rnk_of(sq);
   fil_t f = fil_of(sq);
-  int bdir = orientation_of(p->board[sq]); // bdir: {0,1,2,3} -> {+1 sq, +12 sq, -1 sq, -12 sq}
-  // +1, -1 => change in file
-  // +12, -12 => corresponding change in rank
   uint16_t fire_range;
-  int shift;
-  int hit_pos;
-  piece_t hit_piece;
-  while(true) {
-    switch(bdir) {
-      case 0: // laser moves through increasing rank, constant file
-        //std::cout<<"\n\nFiring through constant file: "<<(int(f))<<". Increasing rank starting at: "<<(int(r))<<". Start square: "<<sq;
-        fire_range = p->bit_files[f];
-        shift = r + 1; // left shift. find LS1.
-        assert(shift >= 1 && shift <= 10);
-        fire_range <<= shift;
-        if (fire_range == 0) {
-          //std::cout<<"\nNo piece in range.";
-          return 0;
-        }
-        hit_pos = __builtin_clz(fire_range) - 15;
-        // hit_pos = 1;
-        // while (!(fire_range & 32768)) {
-        //   hit_pos++;
-        //   fire_range <<= 1;
-        // }
-        // assert(hit_pos == hit_pos2);
-        assert(hit_pos >= 0 && hit_pos < BOARD_WIDTH);
-        r += hit_pos;
-        sq += hit_pos;
-        //std::cout<<"\nLaser moves "<<hit_pos<<" steps and hits square: "<<sq;
-        assert(sq >= 0);
-        assert(sq < ARR_SIZE);
-        assert(square_of(f,r) == sq);
-        break;
-      case 1: // laser moves through increasing file, constant rank
-        //std::cout<<"\n\nFiring through increasing file starting at: "<<(int(f))<<". Constant rank: "<<(int(r))<<". Start square: "<<sq;
-        fire_range = p->bit_ranks[r];
-        shift = f + 1; // range: {1,...,10}. left shift. find MS1.
-        assert(shift >= 1 && shift <= 10);
-        fire_range <<= shift;
-        if (fire_range == 0) {
-          //std::cout<<"\nNo piece in range.";
-          return 0;
-        }
-        hit_pos = __builtin_clz(fire_range) - 15;
-        // hit_pos = 1;
-        // while (!(fire_range & 32768)) {
-        //   hit_pos++;
-        //   fire_range <<= 1;
-        // }
-        // hit_pos now gives the difference in squares between previous piece and next hit piece
-        assert(hit_pos >= 0 && hit_pos < BOARD_WIDTH);
-        f += hit_pos;
-        sq += ARR_WIDTH * hit_pos;
-        //std::cout<<"\nLaser moves "<<hit_pos<<" steps and hits square: "<<sq;
-        assert(sq >= 0);
-        assert(sq < ARR_SIZE);
-        assert(square_of(f,r) == sq);
-        break;
-      case 2: // laser moves through decreasing rank, constant file
-        //std::cout<<"\n\nFiring through constant file: "<<(int(f))<<". Decreasing rank starting at: "<<(int(r))<<". Start square: "<<sq;
-        fire_range = p->bit_files[f];
-        shift = BOARD_WIDTH - r; // right shift. find MS1.
-        assert(shift >= 1 && shift <= 10);
-        fire_range >>= shift + (BITS_PER_VECTOR - BOARD_WIDTH);
-        if (fire_range == 0) {
-          //std::cout<<"\nNo piece in range.";
-          return 0;
-        }
-        hit_pos = __builtin_ctz(fire_range) + 1;
-        // hit_pos = 1;
-        // while (!(fire_range & 1)) {
-        //   hit_pos++;
-        //   fire_range >>= 1;
-        // }
-        // assert(hit_pos2 == hit_pos);
-        assert(hit_pos >= 0 && hit_pos < BOARD_WIDTH);
-        r -= hit_pos;
-        sq -= hit_pos;
-        //std::cout<<"\nLaser moves "<<hit_pos<<" steps and hits square: "<<sq;
-        assert(sq >= 0);
-        assert(sq < ARR_SIZE);
-        assert(square_of(f,r) == sq);
-        break;
-      case 3: // laser moves through decreasing file, constant rank
-        //std::cout<<"\n\nFiring through decreasing file starting at: "<<(int(f))<<". Constant rank: "<<(int(r))<<". Start square: "<<sq;
-        fire_range = p->bit_ranks[r];
-        shift = BOARD_WIDTH - f; // range: {1,...,10}. right shift. find LS1.
-        assert(shift >= 1 && shift <= 10);
-        fire_range >>= shift + (BITS_PER_VECTOR - BOARD_WIDTH);
-        if (fire_range == 0) {
-          //std::cout<<"\nNo piece in range.";
-          return 0;
-        }
-        hit_pos = __builtin_ctz(fire_range) + 1;
-        // hit_pos = 1;
-        // while (!(fire_range & 1)) {
-        //   hit_pos++;
-        //   fire_range >>= 1;
-        // }
-        assert(hit_pos >= 0 && hit_pos < BOARD_WIDTH);
-        f -= hit_pos;
-        sq -= ARR_WIDTH * hit_pos;
-        //std::cout<<"\nLaser moves "<<hit_pos<<" steps and hits square: "<<sq;
-        assert(sq >= 0);
-        assert(sq < ARR_SIZE);
-        assert(square_of(f,r) == sq);
-        break;
-      default:
-        assert(false);
+  switch (bdir) {
+    case 0:  // increasing rank, constant file
+      fire_range = p->bit_files[f] << (r + 1);
+      return fire_range ? sq + (__builtin_clz(fire_range) - 15) : 0;
+    case 1:  // increasing file, constant rank
+      fire_range = p->bit_ranks[r] << (f + 1);
+      return fire_range ? sq + ARR_WIDTH * (__builtin_clz(fire_range) - 15) : 0;
+    case 2:  // decreasing rank, constant file
+      fire_range = p->bit_files[f] >> (BITS_PER_VECTOR - r);
+      return fire_range ? sq - (__builtin_ctz(fire_range) + 1) : 0;
+    case 3:  // decreasing file, constant rank
+      fire_range = p->bit_ranks[r] >> (BITS_PER_VECTOR - f);
+      return fire_range ? sq - ARR_WIDTH * (__builtin_ctz(fire_range) + 1) : 0;
+    default:
+      assert(false);
+      return 0;
+  }
+}
+#endif
+
+// Traces the laser of c's king, one segment per bounce, recording the
+// segments in *path unless it is NULL, and refreshes p->laser[c].  Returns
+// the square of the piece zapped, or 0.
+square_t trace_laser(position_t *p, color_t c, laser_path_t *path) {
+  square_t sq = p->king_locs[c];
+  int bdir = orientation_of(p->board[sq]);
+  assert(ptype_of(p->board[sq]) == KING);
+  bitboard_t lit = square_bbs[sq];
+  int n = 0;
+  square_t victim;
+
+  while (true) {
+    square_t hit = next_on_beam(p, sq, bdir);
+    if (path) {
+      assert(n < MAX_LASER_SEGMENTS);
+      path->from[n] = sq;
+      path->dir[n] = bdir;
+      path->to[n] = hit ? hit : ray_end[sq][bdir];
     }
-    hit_piece = p->board[sq];
-    if (ptype_of(hit_piece) == KING) {
-      //std::cout<<"\nHit king. Returning.";
-      return sq;
+    n++;
+    if (hit == 0) {  // ran off the board
+      lit |= ray_bbs[sq][bdir];
+      victim = 0;
+      break;
     }
-    //std::cout<<"\nHit pawn with orientation: "<<orientation_of(hit_piece);
-    //std::cout<<"\nBeam direction changed from "<<bdir;
-    bdir = reflect_of(bdir, orientation_of(hit_piece));
-    //std::cout<<" to "<<bdir;
-    if (bdir < 0) {
-      //std::cout<<"\nUnshielded pawn. Returning.";
-      return sq;
+    lit |= ray_bbs[sq][bdir] & ~ray_bbs[hit][bdir];
+    bdir = beam_turn[bdir][p->board[hit]];
+    if (bdir < 0) {  // hit a king or the back of a pawn
+      victim = hit;
+      break;
     }
-    //std::cout<<"\nLaser reflected. Continuing.";
+    sq = hit;
+  }
+
+  if (path) {
+    path->count = n;
+    path->victim = victim;
+  }
+  p->laser[c].lit = lit;
+  p->laser[c].victim = victim;
+  p->laser[c].key = p->key;
+  return victim;
+}
+
+square_t fire_old(position_t *p);
+
+// returns square of piece to be removed from board or 0
+square_t fire(position_t *p) {
+  color_t fctm = (color_to_move_of(p) == WHITE) ? BLACK : WHITE;
+  if (p->laser[fctm].key == p->key) {
+    assert(p->laser[fctm].victim == fire_old(p));
+    return p->laser[fctm].victim;
   }
+  return trace_laser(p, fctm, NULL);
 }
 
 square_t fire_old(position_t *p) {
@@ -743,14 +1142,69 @@ square_t fire_test(position_t *p) {
   return fnew;
 }
 
-// return 0 or victim piece or KO (== -1)
-piece_t make_move(position_t *previous, position_t *next, move_t mv) {
+// Takes the piece the laser zapped on victim_sq out of the piece sets and
+// carries the laser caches past the zap.  board[] and the key are the
+// caller's, and already updated.
+static inline void remove_zapped(position_t *p, square_t victim_sq,
+                                 piece_t victim) {
+  uint64_t old_key = p->key ^ zob[victim_sq][0] ^ zob[victim_sq][victim];
+  int moved_kings = 0;
+  if (ptype_of(victim) == KING) {
+    moved_kings = 1 << color_of(victim);
+  }
+  carry_lasers(p, old_key, square_bbs[victim_sq], moved_kings);
+
+  if (ptype_of(victim) == PAWN) {
+    p->pawn_count[color_of(victim)]--;
+    p->pawns_between[color_of(victim)] -= in_king_rect(p, victim_sq);
+  }
+#ifdef BITBOARD
+  bb_toggle(p, victim_sq, victim);
+#else
+  rnk_t r = rnk_of(victim_sq);
+  fil_t f = fil_of(victim_sq);
+  //assert(r >= 0 && r < BOARD_WIDTH);
+  //assert(f >= 0 && f < BOARD_WIDTH);
+  reset_bit(p, f, r);
+
+  color_t victim_color = color_of(victim);
+  if (ptype_of(victim)) {
+    int i = 0;
+    square_t sq;
+    while (sq = p->pawns_locs[victim_color][i]) {
+      if (sq == victim_sq) {
+        p->pawns_locs[victim_color][i] = 0;
+        break;
+      }
+      i++;
+    }
+    int j = PAWNS_COUNT - 1;
+    while (!(sq = p->pawns_locs[victim_color][j]) && j >= i) { // Find the index of the first nonzero element from the end of the array
+      j--;
+    }
+    if (j > i) {
+      assert(p->pawns_locs[victim_color][j] != 0);
+      p->pawns_locs[victim_color][i] = p->pawns_locs[victim_color][j];
+      p->pawns_locs[victim_color][j] = 0;
+    }
+    //std::stable_partition(p->pawns_locs[victim_color], p->pawns_locs[victim_color] + PAWNS_COUNT, is_greater_than_zero);  
+  }
+#endif
+}
+
+// Makes mv on p in place and fires the laser, saving in *undo what
+// unmake_move needs to restore p.  undo must stay alive until then, since
+// p->history points to it.  Returns 0 or the victim piece, or KO (== -1),
+// in which case the move has already been taken back.
+piece_t make_move(position_t *p, move_t mv, undo_t *undo) {
   assert(mv != 0);
 
-  low_level_make_move(previous, next, mv);
+  low_level_make_move(p, mv, undo);
+  // the child's key is known; start fetching its hash set while we fire
+  tt_prefetch(p->key);
 
-  //std::cout<<"\nMove "<<ptype_of(previous->board[from_square(mv)])<<" from "<<from_square(mv)<<" to "<<to_square(mv);
-  square_t victim_sq = fire(next);
+  //std::cout<<"\nMove "<<ptype_of(p->board[from_square(mv)])<<" from "<<from_square(mv)<<" to "<<to_square(mv);
+  square_t victim_sq = fire(p);
 
   WHEN_DEBUG_VERBOSE( char buf[MAX_CHARS_IN_MOVE]; )
   WHEN_DEBUG_VERBOSE({
@@ -761,51 +1215,30 @@ piece_t make_move(position_t *previous, position_t *next, move_t mv) {
   })
 
   if (victim_sq == 0) {
-    next->victim = 0;
+    p->victim = 0;
 
     if (USE_KO &&  // Ko rule
-        (next->key == (previous->key ^ zob_color) || next->key == previous->history->key))
+        (p->key == (undo->key ^ zob_color) || p->key == undo->history->key)) {
+      unmake_move(p, undo);
+      STAT_INC(stat_ko);
       return KO;
+    }
 
   } else {  // we definitely hit something with laser
-    next->victim = next->board[victim_sq];
-    next->key ^= zob[victim_sq][next->victim];   // remove from board
-    next->board[victim_sq] = 0;  
-    next->key ^= zob[victim_sq][0];
-
-    assert(ptype_of(next->victim) == PAWN || ptype_of(next->victim) == KING);
-    rnk_t r = rnk_of(victim_sq);
-    fil_t f = fil_of(victim_sq);
-    //assert(r >= 0 && r < BOARD_WIDTH);
-    //assert(f >= 0 && f < BOARD_WIDTH);
-    reset_bit(next, f, r);
-
-    color_t victim_color = color_of(next->victim);
-    if (ptype_of(next->victim)) {
-      int i = 0;
-      square_t sq;
-      while (sq = next->pawns_locs[victim_color][i]) {
-        if (sq == victim_sq) {
-          next->pawns_locs[victim_color][i] = 0;
-          break;
-        }
-        i++;
-      }
-      int j = PAWNS_COUNT - 1;
-      while (!(sq = next->pawns_locs[victim_color][j]) && j >= i) { // Find the index of the first nonzero element from the end of the array
-        j--;
-      }
-      if (j > i) {
-        assert(next->pawns_locs[victim_color][j] != 0);
-        next->pawns_locs[victim_color][i] = next->pawns_locs[victim_color][j];
-        next->pawns_locs[victim_color][j] = 0;
-      }
-      //std::stable_partition(next->pawns_locs[victim_color], next->pawns_locs[victim_color] + PAWNS_COUNT, is_greater_than_zero);  
-    }
-    //std::cout<<"\nChecking after piece death. Victim: "<<ptype_of(next->victim)<<" at location ("<<((int)f)<<", "<<((int)r)<<")";
-    //check_bit_row_and_column(next);
+    undo->victim_sq = victim_sq;
+    p->victim = p->board[victim_sq];
+    p->key ^= zob[victim_sq][p->victim];   // remove from board
+    p->board[victim_sq] = 0;  
+    p->key ^= zob[victim_sq][0];
+    tt_prefetch(p->key);  // the zap changed the key
+
+    assert(ptype_of(p->victim) == PAWN || ptype_of(p->victim) == KING);
+    remove_zapped(p, victim_sq, p->victim);
+    //std::cout<<"\nChecking after piece death. Victim: "<<ptype_of(p->victim)<<" at location ("<<((int)f)<<", "<<((int)r)<<")";
+    //check_bit_row_and_column(p);
 
-    assert(next->key == compute_zob_key(next));
+    assert(p->key == compute_zob_key(p));
+    assert(pawn_counts_consistent(p));
 
     WHEN_DEBUG_VERBOSE({
       square_to_str(victim_sq, buf);
@@ -813,16 +1246,114 @@ piece_t make_move(position_t *previous, position_t *next, move_t mv) {
       DEBUG_LOG(1, "Zapped piece on %s\n", buf);
     })
   }
-  //check_pawns_locs_invariant(next);
-  return next->victim;
+  //check_pawns_locs_invariant(p);
+  return p->victim;
+}
+
+
+// Takes back the move that make_move or low_level_make_move made on p with
+// this undo record.
+void unmake_move(position_t *p, undo_t *undo) {
+  move_t mv = p->last_move;
+  square_t from_sq = from_square(mv);
+  square_t to_sq = to_square(mv);
+
+#ifdef BITBOARD
+  // toggling is its own inverse, so repeat what the move did
+  if (undo->victim_sq != 0) {  // put the zapped piece back
+    p->board[undo->victim_sq] = p->victim;
+    bb_toggle(p, undo->victim_sq, p->victim);
+  }
+  if (to_sq != from_sq) {
+    bb_toggle(p, from_sq, undo->from_piece);
+    bb_toggle(p, to_sq, undo->from_piece);
+    if (ptype_of(undo->to_piece) != EMPTY) {
+      bb_toggle(p, to_sq, undo->to_piece);
+      bb_toggle(p, from_sq, undo->to_piece);
+    }
+  }
+  p->board[from_sq] = undo->from_piece;
+  p->board[to_sq] = undo->to_piece;
+#else
+  if (undo->victim_sq != 0) {  // put the zapped piece back
+    p->board[undo->victim_sq] = p->victim;
+    set_bit(p, fil_of(undo->victim_sq), rnk_of(undo->victim_sq));
+  }
+  if (to_sq != from_sq && ptype_of(undo->to_piece) == EMPTY) {
+    reset_bit(p, fil_of(to_sq), rnk_of(to_sq));
+    set_bit(p, fil_of(from_sq), rnk_of(from_sq));
+  }
+  p->board[from_sq] = undo->from_piece;
+  p->board[to_sq] = undo->to_piece;
+  memcpy(p->pawns_locs, undo->pawns_locs, sizeof(p->pawns_locs));
+#endif
+
+  p->key = undo->key;
+  p->last_move = undo->last_move;
+  p->victim = undo->victim;
+  p->king_locs[WHITE] = undo->king_locs[WHITE];
+  p->king_locs[BLACK] = undo->king_locs[BLACK];
+  p->laser[WHITE] = undo->laser[WHITE];
+  p->laser[BLACK] = undo->laser[BLACK];
+  p->pawn_count[WHITE] = undo->pawn_count[WHITE];
+  p->pawn_count[BLACK] = undo->pawn_count[BLACK];
+  p->pawns_between[WHITE] = undo->pawns_between[WHITE];
+  p->pawns_between[BLACK] = undo->pawns_between[BLACK];
+  p->history = undo->history;
+  p->ply--;
+
+  assert(p->key == compute_zob_key(p));
+#ifdef BITBOARD
+  assert(bitboards_consistent(p));
+#endif
 }
 
 
+// Perft counts of positions already seen, for do_perft_divide.  A record
+// holds a count and its key xor the count, so a record torn by threads
+// writing it at once fails to match and is simply missed.  The depth is
+// folded into the key.
+typedef struct {
+  uint64_t check;
+  uint64_t count;
+} perft_rec_t;
+
+static perft_rec_t *perft_table = NULL;   // NULL when not hashing
+static uint64_t     perft_mask;
+
+static uint64_t perft_key(position_t *p, int depth) {
+  return p->key ^ (0x9e3779b97f4a7c15ULL * (uint64_t) depth);
+}
+
+// Makes mv on p and fires the laser, like make_move but without the Ko
+// rule.  Returns whether a king was hit, in which case the move has
+// already been taken back.
+static bool perft_make_move(position_t *p, move_t mv, undo_t *undo) {
+  low_level_make_move(p, mv, undo);
+  square_t victim_sq = fire(p);  // the guy to disappear
+
+  if (victim_sq != 0) {            // hit a piece
+    ptype_t typ = ptype_of(p->board[victim_sq]);
+    assert((typ != EMPTY) && (typ != INVALID));
+    if (typ == KING) {  // do not expand further: hit a King
+      unmake_move(p, undo);
+      return true;
+    }
+    undo->victim_sq = victim_sq;
+    p->victim = p->board[victim_sq];
+    p->key ^= zob[victim_sq][p->victim];   // remove from board
+    p->board[victim_sq] = 0;
+    p->key ^= zob[victim_sq][0];
+    remove_zapped(p, victim_sq, p->victim);
+  }
+  return false;
+}
+
 // helper function for do_perft
 // ply starting with 0
 static uint64_t perft_search(position_t *p, int depth, int ply) {
   uint64_t node_count = 0;
-  position_t np;
+  undo_t undo;
   sortable_move_t lst[MAX_NUM_MOVES];
   int num_moves;
   int i;
@@ -831,6 +1362,17 @@ static uint64_t perft_search(position_t *p, int depth, int ply) {
     return 1;
   }
 
+  perft_rec_t *rec = NULL;
+  uint64_t key = 0;
+  if (perft_table != NULL && depth >= 2) {
+    key = perft_key(p, depth);
+    rec = &perft_table[key & perft_mask];
+    perft_rec_t seen = *rec;
+    if ((seen.check ^ seen.count) == key) {
+      return seen.count;
+    }
+  }
+
   num_moves = generate_all(p, lst);
 
   if (depth == 1) {
@@ -840,26 +1382,20 @@ static uint64_t perft_search(position_t *p, int depth, int ply) {
   for (i = 0; i < num_moves; i++) {
     move_t mv = get_move(lst[i]);
 
-    low_level_make_move(p, &np, mv);  // make the move baby!
-    square_t victim_sq = fire(&np);  // the guy to disappear
-
-    if (victim_sq != 0) {            // hit a piece
-      ptype_t typ = ptype_of(np.board[victim_sq]);
-      assert((typ != EMPTY) && (typ != INVALID));
-      if (typ == KING) {  // do not expand further: hit a King
-        node_count++;
-        continue;
-      }
-      np.victim = np.board[victim_sq];
-      np.key ^= zob[victim_sq][np.victim];   // remove from board
-      np.board[victim_sq] = 0;
-      np.key ^= zob[victim_sq][0];
+    if (perft_make_move(p, mv, &undo)) {
+      node_count++;
+      continue;
     }
 
-    uint64_t partialcount = perft_search(&np, depth-1, ply+1);
+    uint64_t partialcount = perft_search(p, depth-1, ply+1);
     node_count += partialcount;
+    unmake_move(p, &undo);
   }
 
+  if (rec != NULL) {
+    rec->check = key ^ node_count;
+    rec->count = node_count;
+  }
   return node_count;
 }
 
@@ -874,6 +1410,55 @@ void do_perft(position_t *gme, int depth, int ply) {
   }
 }
 
+// Like do_perft, but the root moves are counted in parallel by the Cilk
+// workers, transpositions are counted once with a table of hash_mb
+// megabytes, and the count under each root move at the last depth is
+// printed too, to narrow a wrong count down to a move.
+void do_perft_divide(position_t *gme, int depth, int hash_mb) {
+  fen_to_pos(gme, "");
+
+  uint64_t num_recs = 1;
+  while (num_recs * 2 * sizeof(perft_rec_t) <= ((uint64_t) hash_mb << 20)) {
+    num_recs *= 2;
+  }
+  perft_table = (perft_rec_t *) calloc(num_recs, sizeof(perft_rec_t));
+  if (perft_table == NULL) {
+    fprintf(stderr, "Could not allocate %d MB for perft\n", hash_mb);
+    return;
+  }
+  perft_mask = num_recs - 1;
+
+  sortable_move_t lst[MAX_NUM_MOVES];
+  int num_moves = generate_all(gme, lst);
+  uint64_t counts[MAX_NUM_MOVES];
+
+  for (int d = 1; d <= depth; d++) {
+    cilk_for (int i = 0; i < num_moves; i++) {
+      position_t np = *gme;
+      undo_t undo;
+      if (perft_make_move(&np, get_move(lst[i]), &undo)) {
+        counts[i] = 1;
+      } else {
+        counts[i] = perft_search(&np, d - 1, 1);
+      }
+    }
+
+    uint64_t total = 0;
+    for (int i = 0; i < num_moves; i++) {
+      if (d == depth) {
+        char buf[MAX_CHARS_IN_MOVE];
+        move_to_str(get_move(lst[i]), buf);
+        printf("divide %s %" PRIu64 "\n", buf, counts[i]);
+      }
+      total += counts[i];
+    }
+    printf("perft %2d %" PRIu64 "\n", d, total);
+  }
+
+  free(perft_table);
+  perft_table = NULL;
+}
+
 void display(position_t *p) {
   char buf[MAX_CHARS_IN_MOVE];
 
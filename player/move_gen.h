@@ -39,7 +39,8 @@
 #define MAX_CHARS_IN_MOVE 16  // Could be less
 #define MAX_CHARS_IN_TOKEN 64
 
-// the board (which is 10x10) is centered in a 16x16 array
+// the board (which is 10x10) is centered in a 12x12 array.  The square
+// tables are generated from these constants, so 16 works as well.
 #define ARR_WIDTH 12
 #define ARR_SIZE (ARR_WIDTH * ARR_WIDTH)
 
@@ -61,7 +62,7 @@ typedef char fil_t;
 #define RNK_SHIFT 0
 #define RNK_MASK 15
 
-#define CACHE_LINE_ALIGNMENT __declspec(align(64))
+#define CACHE_LINE_ALIGNMENT __attribute__((aligned(64)))
 //----------------------------------------------------------------------
 // pieces
 
@@ -135,6 +136,12 @@ typedef enum {
 typedef uint32_t move_t;
 typedef uint64_t sortable_move_t;
 
+// the stages of generate_moves()
+typedef enum {
+  LASER_MOVES,   // moves that may zap an enemy piece
+  QUIET_MOVES    // the rest
+} move_stage_t;
+
 // Rotations
 typedef enum {
   NONE,
@@ -148,21 +155,75 @@ typedef enum {
 // position
 //TODO: Figure out the optimal ordering of this.
 
+struct undo;
+
+// A set of squares of the 10x10 board, square (f, r) being bit
+// f * BOARD_WIDTH + r, so a rank step is one bit and a file step
+// BOARD_WIDTH bits.  With BITBOARD, the position keeps its piece sets as
+// such masks, board[] staying the lookup of the piece on a square.
+// Without it, pawns_locs and the bit_ranks / bit_files vectors are kept
+// instead.
+typedef __uint128_t bitboard_t;
+
+// What is known of one king's laser.  It is good for the position whose
+// key is key, and make_move carries it forward to the child when the move
+// stays off the lit squares, so the laser is traced again only when a
+// move can have changed it.
+typedef struct laser_cache {
+  bitboard_t   lit;              // squares the laser lights, its king's too
+  uint64_t     key;              // position lit and victim are good for
+  uint64_t     h_key;            // position h_attackable is good for
+  square_t     victim;           // square of the piece zapped, or 0
+  int          h_attackable;     // h_squares_attackable()
+} laser_cache_t;
+
 typedef struct position {
   uint64_t     key;              // hash key
   move_t       last_move;        // move that led to this position
   piece_t      victim;           // piece destroyed by shooter
   square_t     king_locs[2];     // location of kings
-  struct position  *history;     // history of position
+  struct undo  *history;         // history of position
   short int    ply;              // Even ply are White, odd are Black
   piece_t      board[ARR_SIZE];
+  laser_cache_t laser[2];        // each color's laser
+  // running counts for eval: each color's pawns, and how many of them are
+  // in the rectangle with the kings at its corners
+  int          pawn_count[2];
+  int          pawns_between[2];
+#ifdef BITBOARD
+  bitboard_t   occupied;         // every piece
+  bitboard_t   color_bb[2];      // pieces of each color
+  bitboard_t   pawn_bb;          // pawns of both colors
+#else
   square_t     pawns_locs[2][PAWNS_COUNT + 1]; // Locations of the pawns
   //bitset<BITS_PER_BOARD_SIDE>     bit_ranks[BOARD_WIDTH];
   //bitset<BITS_PER_BOARD_SIDE>     bit_files[BOARD_WIDTH];
   uint16_t bit_ranks[BOARD_WIDTH];
   uint16_t bit_files[BOARD_WIDTH];
+#endif
 } position_t;
 
+// Moves are made and taken back in place.  An undo record keeps what
+// unmake_move needs to restore the position, and the key, victim and
+// history of the position the move was made from, which is all that the
+// repetition and Ko checks look at in earlier positions.
+typedef struct undo {
+  uint64_t     key;              // state of the position before the move
+  move_t       last_move;
+  piece_t      victim;
+  square_t     king_locs[2];
+  struct undo  *history;
+  piece_t      from_piece;       // pieces on the move's squares before it
+  piece_t      to_piece;
+  square_t     victim_sq;        // square the laser zapped, or 0
+  laser_cache_t laser[2];
+  int          pawn_count[2];
+  int          pawns_between[2];
+#ifndef BITBOARD
+  square_t     pawns_locs[2][PAWNS_COUNT + 1];
+#endif
+} undo_t;
+
 #define BITS_PER_VECTOR 16
 
 // Function prototypes
@@ -183,17 +244,58 @@ void set_ori(piece_t *x, int ori);
 void init_zob();
 //square_t square_of(fil_t f, rnk_t r);
 
-const unsigned char square_of_table[10][10] = {
-{'\xd', '\xe', '\xf', '\x10', '\x11', '\x12', '\x13', '\x14', '\x15', '\x16'},
-{'\x19', '\x1a', '\x1b', '\x1c', '\x1d', '\x1e', '\x1f', '\x20', '\x21', '\x22'},
-{'\x25', '\x26', '\x27', '\x28', '\x29', '\x2a', '\x2b', '\x2c', '\x2d', '\x2e'},
-{'\x31', '\x32', '\x33', '\x34', '\x35', '\x36', '\x37', '\x38', '\x39', '\x3a'},
-{'\x3d', '\x3e', '\x3f', '\x40', '\x41', '\x42', '\x43', '\x44', '\x45', '\x46'},
-{'\x49', '\x4a', '\x4b', '\x4c', '\x4d', '\x4e', '\x4f', '\x50', '\x51', '\x52'},
-{'\x55', '\x56', '\x57', '\x58', '\x59', '\x5a', '\x5b', '\x5c', '\x5d', '\x5e'},
-{'\x61', '\x62', '\x63', '\x64', '\x65', '\x66', '\x67', '\x68', '\x69', '\x6a'},
-{'\x6d', '\x6e', '\x6f', '\x70', '\x71', '\x72', '\x73', '\x74', '\x75', '\x76'},
-{'\x79', '\x7a', '\x7b', '\x7c', '\x7d', '\x7e', '\x7f', '\x80', '\x81', '\x82'},
+//----------------------------------------------------------------------
+// Tables generated at compile time
+
+// TABLE_REPn(M, a, i) expands to M(a, i), M(a, i + 1), ..., M(a, i + n - 1),
+// so a table's entries are written once, as a formula of their index.
+#define TABLE_REP4(M, a, i) \
+  M(a, i), M(a, (i) + 1), M(a, (i) + 2), M(a, (i) + 3)
+#define TABLE_REP16(M, a, i) \
+  TABLE_REP4(M, a, i), TABLE_REP4(M, a, (i) + 4), \
+  TABLE_REP4(M, a, (i) + 8), TABLE_REP4(M, a, (i) + 12)
+#define TABLE_REP64(M, a, i) \
+  TABLE_REP16(M, a, i), TABLE_REP16(M, a, (i) + 16), \
+  TABLE_REP16(M, a, (i) + 32), TABLE_REP16(M, a, (i) + 48)
+#define TABLE_REP256(M, a, i) \
+  TABLE_REP64(M, a, i), TABLE_REP64(M, a, (i) + 64), \
+  TABLE_REP64(M, a, (i) + 128), TABLE_REP64(M, a, (i) + 192)
+// the same again, for the rows of a table whose rows use TABLE_REPn
+#define TABLE_ROWS4(M, a, i) \
+  M(a, i), M(a, (i) + 1), M(a, (i) + 2), M(a, (i) + 3)
+#define TABLE_ROWS16(M, a, i) \
+  TABLE_ROWS4(M, a, i), TABLE_ROWS4(M, a, (i) + 4), \
+  TABLE_ROWS4(M, a, (i) + 8), TABLE_ROWS4(M, a, (i) + 12)
+
+// Tables indexed by square have SQ_TABLE_SIZE entries, enough for a board
+// padded out to a 16x16 array.  Entries past ARR_SIZE are never read.
+#define SQ_TABLE_SIZE 256
+#define SQ_TABLE(M) TABLE_REP256(M, 0, 0)
+typedef char arr_size_fits_sq_tables[ARR_SIZE <= SQ_TABLE_SIZE ? 1 : -1];
+
+// file and rank of square sq, and whether it is on the board
+template <int sq> struct sq_info {
+  enum {
+    fil = sq / ARR_WIDTH - FIL_ORIGIN,
+    rnk = sq % ARR_WIDTH - RNK_ORIGIN,
+    on_board = sq < ARR_SIZE && fil >= 0 && fil < BOARD_WIDTH &&
+               rnk >= 0 && rnk < BOARD_WIDTH,
+    // bit of sq in a bitboard, 0 off the board
+    bit = on_board ? fil * BOARD_WIDTH + rnk : 0
+  };
+};
+
+// BOARD_WIDTH off the board
+#define FIL_OF_ENTRY(a, sq) \
+  (sq_info<(sq)>::on_board ? sq_info<(sq)>::fil : BOARD_WIDTH)
+#define RNK_OF_ENTRY(a, sq) \
+  (sq_info<(sq)>::on_board ? sq_info<(sq)>::rnk : BOARD_WIDTH)
+
+const unsigned char fil_of_table[SQ_TABLE_SIZE] CACHE_LINE_ALIGNMENT = {
+  SQ_TABLE(FIL_OF_ENTRY)
+};
+const unsigned char rnk_of_table[SQ_TABLE_SIZE] CACHE_LINE_ALIGNMENT = {
+  SQ_TABLE(RNK_OF_ENTRY)
 };
 
 inline square_t square_of(fil_t f, rnk_t r) {
@@ -205,22 +307,6 @@ inline square_t square_of(fil_t f, rnk_t r) {
   return s;
 }
 
-const unsigned char fil_of_table[144] = {
-  '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa',
-  '\xa', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\xa',
-  '\xa', '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', '\xa',
-  '\xa', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\xa',
-  '\xa', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\xa',
-  '\xa', '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', '\xa',
-  '\xa', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\xa',
-  '\xa', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\xa',
-  '\xa', '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', '\xa',
-  '\xa', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\xa',
-  '\xa', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\xa',
-  '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa',
-  };
-
-
 inline fil_t fil_of(square_t sq) {
   fil_t f = (fil_t) (fil_of_table[sq]);
   // fil_t f = ((sq >> FIL_SHIFT) & FIL_MASK) - FIL_ORIGIN;
@@ -230,21 +316,6 @@ inline fil_t fil_of(square_t sq) {
   return f;
 }
 
-const unsigned char rnk_of_table[144] = {
-  '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa',
-  '\xa', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa',
-  '\xa', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa',
-  '\xa', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa',
-  '\xa', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa',
-  '\xa', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa',
-  '\xa', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa',
-  '\xa', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa',
-  '\xa', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa',
-  '\xa', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa',
-  '\xa', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa',
-  '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa', '\xa',
-  };
-
 inline rnk_t rnk_of(square_t sq) {
   rnk_t r = (rnk_t) (rnk_of_table[sq]);
   assert((rnk_t)((sq % ARR_WIDTH) - RNK_ORIGIN) == r);
@@ -257,6 +328,46 @@ inline bool is_greater_than_zero (square_t sq) {
   return (sq > 0); 
 }
 
+// mask of each square, 0 off board
+extern const bitboard_t square_bbs[SQ_TABLE_SIZE];
+// square of each bit
+extern const square_t   bit_squares[SQ_TABLE_SIZE];
+// squares beyond sq in each beam direction
+extern const bitboard_t ray_bbs[SQ_TABLE_SIZE][NUM_ORIENTATION];
+
+inline int bb_lsb(bitboard_t b) {
+  assert(b != 0);
+  uint64_t lo = (uint64_t) b;
+  return lo ? __builtin_ctzll(lo) : 64 + __builtin_ctzll((uint64_t) (b >> 64));
+}
+
+inline int bb_msb(bitboard_t b) {
+  assert(b != 0);
+  uint64_t hi = (uint64_t) (b >> 64);
+  return hi ? 127 - __builtin_clzll(hi) : 63 - __builtin_clzll((uint64_t) b);
+}
+
+inline int bb_popcount(bitboard_t b) {
+  return __builtin_popcountll((uint64_t) b) +
+         __builtin_popcountll((uint64_t) (b >> 64));
+}
+
+// square of the lowest piece in b
+inline square_t bb_first_square(bitboard_t b) {
+  return bit_squares[bb_lsb(b)];
+}
+
+#ifdef BITBOARD
+// adds piece x on sq to the masks, or removes it if it is there
+inline void bb_toggle(position *p, square_t sq, piece_t x) {
+  bitboard_t b = square_bbs[sq];
+  p->occupied ^= b;
+  p->color_bb[(x >> COLOR_SHIFT) & COLOR_MASK] ^= b;
+  if (ptype_of(x) == PAWN) {
+    p->pawn_bb ^= b;
+  }
+}
+#else
 inline void reset_bit(position *p, fil_t f, rnk_t r) {
   
   p->bit_ranks[r] &= ~(1 << (BITS_PER_VECTOR - f - 1)); // reset r'th column's f'th bit to 0. bitmask needed is all ones except f'th bit.                 
@@ -277,6 +388,8 @@ inline void set_bit(position *p, fil_t f, rnk_t r) {
   */
 }
 
+#endif
+
 inline square_t from_square(move_t mv) {
   return (mv >> FROM_SHIFT) & FROM_MASK;
 }
@@ -309,36 +422,70 @@ rnk_t rnk_of(square_t sq);
 int square_to_str(square_t sq, char *buf);
 int dir_of(int i);
 
-// directions for laser: NN, EE, SS, WW                                                                                                                                             
-static int beam[NUM_ORIENTATION] = {1, ARR_WIDTH, -1, -ARR_WIDTH};
+// directions for laser: NN, EE, SS, WW
+static const int beam[NUM_ORIENTATION] = {1, ARR_WIDTH, -1, -ARR_WIDTH};
 
 inline int beam_of(int direction) {
   assert(direction >= 0 && direction < NUM_ORIENTATION);
   return beam[direction];
 }
 
-// reflect[beam_dir][pawn_orientation]                                                                                                                                              
-// -1 indicates back of Pawn                                                                                                                                                        
-static int reflect[NUM_ORIENTATION][NUM_ORIENTATION] = {
-  //  NW  NE  SE  SW                                                                                                                                                                
-  { -1, -1, EE, WW},   // NN = beam_dir 0                                                                                                                                           
-  { NN, -1, -1, SS},   // EE = beam_dir 1                                                                                                                                           
-  { WW, EE, -1, -1 },  // SS = beam_dir 2                                                                                                                                           
-  { -1, NN, SS, -1 }   // WW = beam_dir 3                                                                                                                                           
-};
+// reflect[beam_dir][pawn_orientation], packed 3 bits an entry as d + 1 so
+// that it is a constant expression.  -1 indicates back of Pawn.
+#define REFLECT_ROW(bdir, nw, ne, se, sw)                               \
+  ((uint64_t) (((nw) + 1) | ((ne) + 1) << 3 | ((se) + 1) << 6 |          \
+               ((sw) + 1) << 9) << (12 * (bdir)))
+#define REFLECT_BITS                        \
+  /*              NW  NE  SE  SW */          \
+  (REFLECT_ROW(NN, -1, -1, EE, WW) |         \
+   REFLECT_ROW(EE, NN, -1, -1, SS) |         \
+   REFLECT_ROW(SS, WW, EE, -1, -1) |         \
+   REFLECT_ROW(WW, -1, NN, SS, -1))
+#define REFLECT(bdir, ori) \
+  ((int) ((REFLECT_BITS >> (12 * (bdir) + 3 * (ori))) & 7) - 1)
 
 inline int reflect_of(int beam_dir, int pawn_orientation) {
   assert(beam_dir >= 0 && beam_dir < NUM_ORIENTATION);
   assert(pawn_orientation >= 0 && pawn_orientation < NUM_ORIENTATION);
-  return reflect[beam_dir][pawn_orientation];
+  return REFLECT(beam_dir, pawn_orientation);
 }
+// The path of one king's laser, as the straight segments between bounces.
+// Segment i leaves from[i] in direction dir[i] and lights every square up
+// to and including to[i]: the piece it hits, or the last square before the
+// edge.  from[0] is the king.
+#define MAX_LASER_SEGMENTS (4 * PAWNS_COUNT + 1)  // two faces per pawn
+
+typedef struct laser_path {
+  square_t     from[MAX_LASER_SEGMENTS];
+  square_t     to[MAX_LASER_SEGMENTS];
+  int          dir[MAX_LASER_SEGMENTS];
+  int          count;            // number of segments
+  square_t     victim;           // square of the piece zapped, or 0
+} laser_path_t;
+
+void count_pawns(position_t *p);
+void count_pawns_between(position_t *p, square_t a, square_t b,
+                         int between[2]);
+square_t trace_laser(position_t *p, color_t c, laser_path_t *path);
+
 bool is_move_valid(position_t *p, move_t mv);
 ptype_t ptype_mv_of(move_t mv);
 void move_to_str(move_t mv, char *buf);
 int generate_all(position_t *p, sortable_move_t *sortable_move_list);
+int generate_moves(position_t *p, sortable_move_t *sortable_move_list,
+                   move_stage_t stage);
+bool is_laser_move(position_t *p, move_t mv);
 void do_perft(position_t *gme, int depth, int ply);
-piece_t make_move(position_t *previous, position_t *next, move_t mv);
+void do_perft_divide(position_t *gme, int depth, int hash_mb);
+piece_t make_move(position_t *p, move_t mv, undo_t *undo);
+void unmake_move(position_t *p, undo_t *undo);
 void display(position_t *p);
 uint64_t compute_zob_key(position_t *p);
+square_t fire(position_t *p);
+
+// reference versions the ones above replaced, for testing and kbench
+int generate_all_old(position_t *p, sortable_move_t *sortable_move_list,
+                     bool strict);
+square_t fire_old(position_t *p);
 
 #endif  // MOVE_GEN_H
@@ -29,12 +29,16 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <algorithm>
+#include <cilk/cilk.h>
+#include <cilk/cilk_api.h>
 
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
 
+#include "abort.hpp"
 #include "eval.h"
 #include "search.h"
+#include "stats.h"
 #include "tt.h"
 #include "util.h"
 
@@ -64,8 +68,47 @@ int DETECT_DRAWS;  // Detect draws by repetition
 // do not set more than 5 ply
 int FUT_DEPTH;     // set to zero for no futilty
 
+int THREADS;       // number of Cilk workers used by the search
+
+// Young Brothers Wait: nodes at least this deep search their younger
+// brothers in parallel once the eldest brother has been searched
+#define PARALLEL_DEPTH 3
+
+
+// Killers and move history are kept per Cilk worker, so that workers
+// searching brothers in parallel learn apart and never share a cache line
+// of them.  A node takes its worker's tables once, on entry, and keeps
+// them even if it is resumed on another worker after a parallel scout.
+//
+// History is only for pawns and kings, to squares from the first board
+// square on: the smallest span of the array that holds the board.
+#define NUM_KILLERS 2
+#define HISTORY_SQUARES (ARR_WIDTH * (BOARD_WIDTH - 1) + BOARD_WIDTH)
+#define HISTORY_ORIGIN (ARR_WIDTH * FIL_ORIGIN + RNK_ORIGIN)
+
+typedef struct {
+  move_t killer[MAX_PLY_IN_SEARCH][NUM_KILLERS];
+  //      history[color_t][ptype_t - PAWN][square_t - HISTORY_ORIGIN][orientation]
+  int history[2][2][HISTORY_SQUARES][NUM_ORIENTATION];
+} CACHE_LINE_ALIGNMENT move_order_t;
+
+static move_order_t move_order[MAX_THREADS];
+
+static move_order_t *worker_move_order() {
+  int worker = __cilkrts_get_worker_number();
+  // threads that are not Cilk workers share the first tables
+  if (worker < 0 || worker >= MAX_THREADS) {
+    worker = 0;
+  }
+  return &move_order[worker];
+}
 
-static move_t killer[MAX_PLY_IN_SEARCH][4];   // up to 4 killers
+static int *history_of(move_order_t *mo, color_t c, ptype_t pce,
+                       square_t ts, int ot) {
+  assert(pce == PAWN || pce == KING);
+  assert(ts >= HISTORY_ORIGIN && ts < HISTORY_ORIGIN + HISTORY_SQUARES);
+  return &mo->history[c][pce - PAWN][ts - HISTORY_ORIGIN][ot];
+}
 
 sort_key_t sort_key(sortable_move_t mv) {
   return (sort_key_t) ((mv >> SORT_SHIFT) & SORT_MASK);
@@ -83,6 +126,78 @@ move_t get_move(sortable_move_t sortable_mv) {
   return (move_t) (sortable_mv & MOVE_MASK);
 }
 
+static bool sort_key_greater(sortable_move_t a, sortable_move_t b) {
+  return sort_key(a) > sort_key(b);
+}
+
+// sort keys for moves ordered by eval_children_cheap, which can lose a
+// little, and for moves with a history (or king moves), which go first
+#define CHILD_KEY_BIAS   (1 << 29)
+#define HISTORY_KEY_BIAS (1 << 30)
+
+// Hands out the moves of a node best first.  Each pick scans the moves
+// not yet tried for the highest sort key (the first of equals, so ties
+// keep their order) and slides it in front of them, so a node that cuts
+// off after a move or two never pays for sorting the rest.  Once the best
+// key left is 0 the remaining moves are taken as they lie, and a node
+// that is still going after PICKER_SCANS picks sorts the rest at once.
+#define PICKER_SCANS 6
+
+typedef struct {
+  sortable_move_t *moves;
+  int count;
+  int scans;      // picks made by scanning
+  bool sorted;    // moves not yet picked are in order already
+} move_picker_t;
+
+static void picker_init(move_picker_t *mp, sortable_move_t *moves,
+                        int count) {
+  mp->moves = moves;
+  mp->count = count;
+  mp->scans = 0;
+  mp->sorted = false;
+}
+
+// sorts all of moves[index..count), for searching them in parallel
+static void picker_sort_rest(move_picker_t *mp, int index) {
+  if (!mp->sorted) {
+    std::stable_sort(mp->moves + index, mp->moves + mp->count,
+                     sort_key_greater);
+    mp->sorted = true;
+  }
+}
+
+// puts the best of moves[index..count) at index
+static void picker_pick(move_picker_t *mp, int index) {
+  if (mp->sorted) {
+    return;
+  }
+  if (mp->scans++ == PICKER_SCANS) {
+    picker_sort_rest(mp, index);
+    return;
+  }
+  sortable_move_t *moves = mp->moves;
+  int best = index;
+  sort_key_t best_key = sort_key(moves[index]);
+  for (int i = index + 1; i < mp->count; i++) {
+    sort_key_t key = sort_key(moves[i]);
+    if (key > best_key) {
+      best = i;
+      best_key = key;
+    }
+  }
+  if (best_key == 0) {
+    mp->sorted = true;
+    return;
+  }
+  if (best != index) {
+    sortable_move_t mv = moves[best];
+    memmove(moves + index + 1, moves + index,
+            sizeof(sortable_move_t) * (best - index));
+    moves[index] = mv;
+  }
+}
+
 
 // note: these need to be tuned but this should be pretty conservative
 //       probably we would only use 3 or 4 of these values at most
@@ -94,7 +209,9 @@ static score_t fmarg[10] = {
 };
 
 void init_killer() {
-  memset(killer, 0, sizeof(killer));  // clear any killer info
+  for (int i = 0; i < MAX_THREADS; i++) {  // clear any killer info
+    memset(move_order[i].killer, 0, sizeof(move_order[i].killer));
+  }
 }
 
 
@@ -104,7 +221,7 @@ void init_killer() {
 static int     tics = 0;
 static double  sstart;    // start time of a search in milliseconds
 static double  timeout;   // time elapsed before abort
-static bool    abortf = false;  // abort flag for search
+static Abort   root_abort;  // aborting it ends the whole search
 
 void init_abort_timer(double goal_time) {
   sstart = milliseconds();
@@ -117,17 +234,34 @@ double elapsed_time() {
 }
 
 bool should_abort() {
-  return abortf;
+  return root_abort.isAborted();
 }
 
 void reset_abort() {
-  abortf = false;
+  root_abort.reset();
+}
+
+// Ends the search from outside it, as a "stop" does.
+void abort_search() {
+  root_abort.abort();
 }
 
 void init_tics() {
   tics = 0;
 }
 
+// Set the number of Cilk workers.  Must be called outside of any parallel
+// region, since it shuts the runtime down before changing the worker count.
+void init_threads(int num_threads) {
+  char buf[MAX_CHARS_IN_TOKEN];
+  sprintf(buf, "%d", num_threads);
+
+  __cilkrts_end_cilk();
+  if (__cilkrts_set_param("nworkers", buf) != __CILKRTS_SET_PARAM_SUCCESS) {
+    fprintf(stderr, "Could not set number of workers to %d\n", num_threads);
+  }
+}
+
 // --------------------------
 // Detect repetition
 // --------------------------
@@ -136,7 +270,7 @@ static bool is_repeated(position_t *p, score_t *score, int ply) {
     return false;   // no draw detected
   }
 
-  position_t *x = p->history;
+  undo_t *x = p->history;
   uint64_t cur = p->key;
 
   while (true) {
@@ -160,16 +294,16 @@ static bool is_repeated(position_t *p, score_t *score, int ply) {
   return false;
 }
 
-//      best_move_history[color_t][piece_t][square_t][orientation]
-static int best_move_history[2][6][ARR_SIZE][NUM_ORIENTATION];
-
 void init_best_move_history() {
-  memset(best_move_history, 0, sizeof(best_move_history));
+  for (int i = 0; i < MAX_THREADS; i++) {
+    memset(move_order[i].history, 0, sizeof(move_order[i].history));
+  }
 }
 
-static void update_best_move_history(position_t *p, int index_of_best,
+static void update_best_move_history(move_order_t *mo, position_t *p,
+                                     int index_of_best,
                                      sortable_move_t *lst, int count) {
-  int ctm = color_to_move_of(p);
+  color_t ctm = color_to_move_of(p);
 
   for (int i = 0; i < count; i++) {
     move_t   mv  = get_move(lst[i]);
@@ -179,16 +313,17 @@ static void update_best_move_history(position_t *p, int index_of_best,
     int      ot  = ORIENTATION_MASK & (orientation_of(p->board[fs]) + ro);
     square_t ts  = to_square(mv);
 
-    int  s = best_move_history[ctm][pce][ts][ot];
+    int *h = history_of(mo, ctm, pce, ts, ot);
+    int  s = *h;
 
     if (index_of_best == i) {
       s = s + 11200;     // number will never exceed 1017
     }
-    s = s * 0.90;
+    s = s * 9 / 10;      // the same as truncating s * 0.90, in integers
 
     assert(s < 102000);  // or else sorting will fail
 
-    best_move_history[ctm][pce][ts][ot] = s;
+    *h = s;
   }
 }
 
@@ -243,10 +378,95 @@ static bool is_game_over(piece_t victim, score_t *score, int pov, int ply) {
 }
 
 static score_t scout_search(position_t *p, score_t beta, int depth,
-                            int ply, int reduction, move_t *pv, uint64_t *node_count) {
+                            int ply, int reduction, move_t *pv, uint64_t *node_count,
+                            Abort *pAbort);
+
+// Scout one of the younger brothers of a parallel node: make move mv and
+// test whether it scores at least beta.  Returns -INF if mv is a KO.  The
+// make_move itself is not counted in node_count, since the caller makes
+// the move again when it collects the result.  Brothers run concurrently,
+// so each makes its move on its own copy of p; the copy shares p's history.
+static score_t scout_child(position_t *p, move_t mv, score_t beta, int depth,
+                           int ply, int reduction, uint64_t *node_count,
+                           Abort *pAbort) {
+  position_t np = *p;
+  undo_t undo;
+  move_t subpv[MAX_PLY_IN_SEARCH];
+  color_t fctm = color_to_move_of(p);
+  int pov = 1 - fctm*2;
+  int ext = 0;
+  score_t score;
+
+  piece_t victim = make_move(&np, mv, &undo);
+  if (victim == KO) {
+    return -INF;
+  }
+  if (is_game_over(victim, &score, pov, ply) || is_repeated(&np, &score, ply)) {
+    return score;
+  }
+  if (victim > 0) {
+    reduction = 0;   // only quiet moves are reduced
+    if (color_of(np.victim) != fctm) {
+      ext = 1;       // extend captures
+    }
+  }
+  return -scout_search(&np, -(beta - 1), ext + depth - 1, ply + 1, reduction,
+                       subpv, node_count, pAbort);
+}
+
+// Young Brothers Wait: once the eldest brother of a node has been searched
+// serially, the younger brothers move_list[first..last) are scouted in
+// parallel against beta, and their scores left in scores[].  As soon as one
+// of them scores at least cutoff, the brothers still running are aborted
+// and no new ones are started; those without a valid score (and KO moves)
+// get -INF.  Returns whether some brother reached cutoff.
+//
+// The late move reduction of a brother is decided from its position in the
+// list, counting from the legal_move_count moves already searched.
+static bool scout_siblings(position_t *p, score_t beta, score_t cutoff,
+                           int depth, int ply, sortable_move_t *move_list,
+                           int first, int last, int legal_move_count,
+                           bool use_lmr, score_t *scores, uint64_t *node_count,
+                           Abort *pAbort) {
+  uint64_t counts[MAX_NUM_MOVES];
+  // aborting this cancels the brothers, but not the rest of the search
+  Abort siblings_abort(pAbort);
+
+  cilk_for (int i = first; i < last; i++) {
+    counts[i] = 0;
+    scores[i] = -INF;
+    if (siblings_abort.isAborted()) {
+      continue;
+    }
+
+    int reduction = 0;
+    int move_count = legal_move_count + (i - first) + 1;
+    if (use_lmr && move_count >= LMR_R1 && depth > 2) {
+      reduction = (move_count >= LMR_R2) ? 2 : 1;
+    }
+    score_t score = scout_child(p, get_move(move_list[i]), beta, depth, ply,
+                                reduction, &counts[i], &siblings_abort);
+    // a search that was cut short returns garbage
+    if (!siblings_abort.isAborted()) {
+      scores[i] = score;
+      if (score >= cutoff) {
+        siblings_abort.abort();
+      }
+    }
+  }
+
+  for (int i = first; i < last; i++) {
+    *node_count += counts[i];
+  }
+  return siblings_abort.isAborted();
+}
+
+static score_t scout_search(position_t *p, score_t beta, int depth,
+                            int ply, int reduction, move_t *pv, uint64_t *node_count,
+                            Abort *pAbort) {
   if (reduction > 0) {
     // We first perform a reduced depth search.
-    int score = scout_search(p, beta, depth - reduction, ply, 0, pv, node_count);
+    int score = scout_search(p, beta, depth - reduction, ply, 0, pv, node_count, pAbort);
     // -(parentBeta-1) = beta --> parentBeta = -beta+1
     int parentBeta = -beta + 1;
     int parentScore = -score;
@@ -254,35 +474,65 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
     if (parentScore < parentBeta) {
       return score;
     }
-    if (abortf) {
+    if (pAbort->isAborted()) {
       return 0;
     }
+    STAT_INC(stat_lmr_researches);
   }
 
   pv[0] = 0;
+  move_order_t *mo = worker_move_order();
   // check whether we should abort
   tics++;
   if ((tics & ABORT_CHECK_PERIOD) == 0) {
     if (milliseconds() >= timeout) {
-      abortf = true;
+      root_abort.abort();
       return 0;
     }
   }
+  // a cutoff in a brother subtree aborts us between time checks
+  if (pAbort->isAborted()) {
+    return 0;
+  }
 
   // get transposition table record if available
   // NOTE: moving this just before the futility pruning gives a drastic improvement
-  ttRec_t *rec = tt_hashtable_get(p->key);
+  ttRec_t rec;
   int hash_table_move = 0;
-  if (rec) {
-    if (tt_is_usable(rec, depth, beta)) {
-      return tt_adjust_score_from_hashtable(rec, ply);
+  if (tt_hashtable_get(p->key, &rec)) {
+    if (tt_is_usable(&rec, depth, beta)) {
+      return tt_adjust_score_from_hashtable(&rec, ply);
     }
-    hash_table_move = tt_move_of(rec);
+    hash_table_move = tt_move_of(&rec);
   }
 
   score_t best_score = -INF;
-  score_t sps = eval(p, false) + HMB;  // stand pat (having-the-move) bonus
   bool quiescence = (depth <= 0);      // are we in quiescence?
+  if (quiescence) {
+    STAT_INC(stat_quiescence_nodes);
+  } else {
+    STAT_INC(stat_full_nodes);
+  }
+
+  // The stand pat score is only compared with beta, in quiescence, and
+  // with the margins below.  Past them it need only be a bound, and at
+  // depths none of them apply it is not needed at all.
+  int sps_alpha = beta - 1;
+  int sps_beta = beta;
+  if (depth > 0 && depth <= FUT_DEPTH) {
+    sps_alpha = beta - fmarg[depth] - 1;
+  }
+  if (USE_NMM && depth == 1) {
+    sps_beta = beta + 3 * PAWN_VALUE;
+  }
+  if (USE_NMM && depth == 2) {
+    sps_beta = beta + 5 * PAWN_VALUE;
+  }
+  score_t sps = 0;
+  if (quiescence || depth <= FUT_DEPTH || (USE_NMM && depth <= 2)) {
+    // stand pat (having-the-move) bonus
+    sps = eval_bounded(p, sps_alpha - HMB, sps_beta - HMB) + HMB;
+  }
   if (quiescence) {
     best_score = sps;
     if (best_score >= beta) {
@@ -294,9 +544,11 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
   if (USE_NMM) {
     if (depth <= 2) {
       if (depth == 1 && sps >= beta + 3 * PAWN_VALUE) {
+        STAT_INC(stat_nmm_prunes);
         return beta;
       }
       if (depth == 2 && sps >= beta + 5 * PAWN_VALUE) {
+        STAT_INC(stat_nmm_prunes);
         return beta;
       }
     }
@@ -306,12 +558,13 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
   if (depth <= FUT_DEPTH && depth > 0) {
     if (sps + fmarg[depth] < beta) {
       // treat this ply as a quiescence ply, look only at captures
+      STAT_INC(stat_futility_prunes);
       quiescence = true;
       best_score = sps;
     }
   }
 
-  position_t np;  // next position
+  undo_t undo;    // to take back the move made
   color_t fctm = color_to_move_of(p);   // color to move
   int pov = 1 - fctm*2;      // point of view = 1 for white, -1 for black
   move_t subpv[MAX_PLY_IN_SEARCH];
@@ -320,8 +573,8 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
   int mv_index;
   int best_move_index = 0;
   bool found_in_topmoves = false;
-  move_t killer_a = killer[ply][0];
-  move_t killer_b = killer[ply][1];
+  move_t killer_a = mo->killer[ply][0];
+  move_t killer_b = mo->killer[ply][1];
   sortable_move_t topmoves[3];
   int num_topmoves = 0;
 
@@ -347,6 +600,9 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
   for (mv_index = 0; mv_index < num_topmoves; mv_index++) {
     subpv[0] = 0;
     move_t mv = get_move(topmoves[mv_index]);
+    if (quiescence && !is_laser_move(p, mv)) {
+      continue;   // cannot capture, so not worth making
+    }
 
     if (TRACE_MOVES) {
       print_move_info(mv, ply);
@@ -355,23 +611,26 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
     bool blunder = false;  // shoot our own piece
 
     (*node_count)++;
-    piece_t victim = make_move(p, &np, mv);  // make the move baby! returns 0 or victim piece or KO (== -1)
+    piece_t victim = make_move(p, mv, &undo);  // make the move baby! returns 0 or victim piece or KO (== -1)
     if (victim == KO) {
       continue;
     }
 
     if (is_game_over(victim, &score, pov, ply)) {
+      unmake_move(p, &undo);
       // Break out of loop.
       goto top_scored;
     }
 
     if (victim == 0 && quiescence) {
+      unmake_move(p, &undo);
       continue;   // ignore noncapture moves in quiescence
     }
-    if (color_of(np.victim) == fctm) {
+    if (color_of(p->victim) == fctm) {
       blunder = true;
     }
     if (quiescence && blunder) {
+      unmake_move(p, &undo);
       continue;  // ignore own piece captures in quiescence
     }
 
@@ -383,15 +642,17 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
       ext = 1;  // extend captures
     }
 
-    if (is_repeated(&np, &score, ply)) {
+    if (is_repeated(p, &score, ply)) {
+      unmake_move(p, &undo);
       // Break out of loop.
       goto top_scored;
     }
 
     assert(legal_move_count < LMR_R1);
-    score = -scout_search(&np, -(beta - 1), ext + depth - 1, ply + 1, 0,
-                          subpv, node_count);
-    if (abortf) {
+    score = -scout_search(p, -(beta - 1), ext + depth - 1, ply + 1, 0,
+                          subpv, node_count, pAbort);
+    unmake_move(p, &undo);
+    if (pAbort->isAborted()) {
       return 0;
     }
     
@@ -404,9 +665,10 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
       pv[MAX_PLY_IN_SEARCH - 1] = 0;
 
       if (score >= beta) {
-        if (mv != killer[ply][0]) {
-          killer[ply][1] = killer[ply][0];
-          killer[ply][0] = mv;
+        STAT_CUTOFF(mv_index);
+        if (mv != mo->killer[ply][0]) {
+          mo->killer[ply][1] = mo->killer[ply][0];
+          mo->killer[ply][0] = mv;
         }
         assert(!(found_in_topmoves));
         found_in_topmoves = true;
@@ -423,7 +685,7 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
       //for (int i = 0; i < 3; i++) { // really needed?
       //  set_sort_key(&topmoves[i], SORT_MASK-i);
       //}
-      update_best_move_history(p, best_move_index, topmoves, mv_index);
+      update_best_move_history(mo, p, best_move_index, topmoves, mv_index);
     }
     assert(abs(best_score) != -INF);
     
@@ -440,19 +702,23 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
 
   //std::cout<<"\n\nNum of topmoves valid: "<<num_topmoves;
   assert(num_topmoves >= 0 && num_topmoves <= 3);
-  assert(killer_a == killer[ply][0]);
-  assert(killer_b == killer[ply][1]);
+  assert(killer_a == mo->killer[ply][0]);
+  assert(killer_b == mo->killer[ply][1]);
 
   // hopefully, more than we will need
   sortable_move_t move_list[MAX_NUM_MOVES];
-  // number of moves in list
-  int original_num_of_moves = generate_all(p, move_list + num_topmoves);
+  // number of moves in list.  In quiescence only moves that may capture
+  // are worth making, and the hash and killer moves need not be among them.
+  int original_num_of_moves =
+      generate_moves(p, move_list + num_topmoves, LASER_MOVES);
+  if (!quiescence) {
+    original_num_of_moves += generate_moves(
+        p, move_list + num_topmoves + original_num_of_moves, QUIET_MOVES);
+  }
   int num_of_moves = original_num_of_moves + num_topmoves;
   int topmoves_found = 0;
-  sortable_move_t tmp;
-  int elements_to_sort = num_topmoves;
 
-  // sort special moves to the front
+  // take out the special moves, which have been searched, and key the rest
   for (mv_index = num_topmoves; mv_index < num_of_moves; mv_index++) {
     move_t mv = get_move(move_list[mv_index]);
     if (mv == hash_table_move || mv == killer_a || mv == killer_b) {
@@ -468,34 +734,70 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
       square_t fs  = from_square(mv);
       int      ot  = ORIENTATION_MASK & (orientation_of(p->board[fs]) + ro);
       square_t ts  = to_square(mv);
-      if (best_move_history[fctm][pce][ts][ot] || pce == KING) {
-        set_sort_key(&move_list[mv_index], best_move_history[fctm][pce][ts][ot]);
-        // guaranteed that elements_to_sort <= mv_index, which ensures that
-        // the following swap does not place a seen element in the unseen
-        // range of the loop, thereby causing it to process the element twice
-        assert(elements_to_sort <= mv_index);
-        tmp = move_list[mv_index];
-        move_list[mv_index] = move_list[elements_to_sort];
-        move_list[elements_to_sort++] = tmp;
+      int      h   = *history_of(mo, fctm, pce, ts, ot);
+      if (h || pce == KING) {
+        set_sort_key(&move_list[mv_index], HISTORY_KEY_BIAS + h);
       }
     }
   }
 
-  assert(topmoves_found == num_topmoves);
+  assert(topmoves_found == num_topmoves || quiescence);
   assert(num_topmoves >= 0 && num_topmoves <= 3);
-  assert(elements_to_sort >= num_topmoves && elements_to_sort <= num_of_moves);
-  assert(num_of_moves == original_num_of_moves);
-  std::sort(move_list + num_topmoves, move_list + elements_to_sort, std::greater<sortable_move_t>());
+  assert(num_of_moves == original_num_of_moves + num_topmoves - topmoves_found);
+
+  // At the frontier, order the moves history knows nothing about by what
+  // their children gain in the cheap eval terms.
+  if (depth == 1 && !quiescence) {
+    sortable_move_t unkeyed[MAX_NUM_MOVES];
+    int where[MAX_NUM_MOVES];
+    int delta[MAX_NUM_MOVES];
+    int num_unkeyed = 0;
+    for (int i = num_topmoves; i < num_of_moves; i++) {
+      if (sort_key(move_list[i]) == 0) {
+        where[num_unkeyed] = i;
+        unkeyed[num_unkeyed++] = move_list[i];
+      }
+    }
+    eval_children_cheap(p, unkeyed, num_unkeyed, delta);
+    for (int i = 0; i < num_unkeyed; i++) {
+      set_sort_key(&move_list[where[i]], CHILD_KEY_BIAS + delta[i]);
+    }
+  }
+
+  move_picker_t picker;
+  picker_init(&picker, move_list, num_of_moves);
 
   best_move_index = 0;   // index of best move found
   //legal_move_count = 0;
 
-  //std::partial_sort(move_list + num_topmoves, move_list + num_topmoves + elements_to_sort, move_list + num_of_moves, std::greater<sortable_move_t>());
+  // moves from parallel_from on have been scouted in parallel
+  int parallel_from = num_of_moves;
+  score_t scout_scores[MAX_NUM_MOVES];
+  bool cutoff_found = false;
 
   for (mv_index = num_topmoves; mv_index < num_of_moves; mv_index++) {
     subpv[0] = 0;
+    picker_pick(&picker, mv_index);
     move_t mv = get_move(move_list[mv_index]);
 
+    // Young Brothers Wait: the eldest brother has been searched, so scout
+    // all the younger ones in parallel and collect their scores below
+    if (THREADS > 1 && parallel_from == num_of_moves && legal_move_count > 0 &&
+        !quiescence && depth >= PARALLEL_DEPTH) {
+      picker_sort_rest(&picker, mv_index);
+      parallel_from = mv_index;
+      cutoff_found = scout_siblings(p, beta, beta, depth, ply, move_list,
+                                    mv_index, num_of_moves, legal_move_count,
+                                    true, scout_scores, node_count, pAbort);
+      if (pAbort->isAborted()) {
+        return 0;
+      }
+    }
+    if (mv_index >= parallel_from && cutoff_found &&
+        scout_scores[mv_index] == -INF) {
+      continue;   // not searched, a younger brother cuts off anyway
+    }
+
     if (TRACE_MOVES) {
       print_move_info(mv, ply);
     }
@@ -504,23 +806,26 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
     bool blunder = false;  // shoot our own piece
 
     (*node_count)++;
-    piece_t victim = make_move(p, &np, mv);  // make the move baby! returns 0 or victim piece or KO (== -1)
+    piece_t victim = make_move(p, mv, &undo);  // make the move baby! returns 0 or victim piece or KO (== -1)
     if (victim == KO) {
       continue;
     }
 
     if (is_game_over(victim, &score, pov, ply)) {
+      unmake_move(p, &undo);
       // Break out of loop.
       goto scored;
     }
 
     if (victim == 0 && quiescence) {
+      unmake_move(p, &undo);
       continue;   // ignore noncapture moves in quiescence
     }
-    if (color_of(np.victim) == fctm) {
+    if (color_of(p->victim) == fctm) {
       blunder = true;
     }
     if (quiescence && blunder) {
+      unmake_move(p, &undo);
       continue;  // ignore own piece captures in quiescence
     }
 
@@ -532,7 +837,8 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
       ext = 1;  // extend captures
     }
 
-    if (is_repeated(&np, &score, ply)) {
+    if (is_repeated(p, &score, ply)) {
+      unmake_move(p, &undo);
       // Break out of loop.
       goto scored;
     }
@@ -550,10 +856,16 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
         }
       }
 
-      score = -scout_search(&np, -(beta - 1), ext + depth - 1, ply + 1, next_reduction,
-          subpv, node_count);
-      if (abortf) {
-        return 0;
+      if (mv_index >= parallel_from && scout_scores[mv_index] != -INF) {
+        score = scout_scores[mv_index];
+        unmake_move(p, &undo);
+      } else {
+        score = -scout_search(p, -(beta - 1), ext + depth - 1, ply + 1, next_reduction,
+            subpv, node_count, pAbort);
+        unmake_move(p, &undo);
+        if (pAbort->isAborted()) {
+          return 0;
+        }
       }
     }
 
@@ -566,9 +878,10 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
       pv[MAX_PLY_IN_SEARCH - 1] = 0;
 
       if (score >= beta) {
-        if (mv != killer[ply][0]) {
-          killer[ply][1] = killer[ply][0];
-          killer[ply][0] = mv;
+        STAT_CUTOFF(mv_index);
+        if (mv != mo->killer[ply][0]) {
+          mo->killer[ply][1] = mo->killer[ply][0];
+          mo->killer[ply][0] = mv;
         }
         break;
       }
@@ -579,7 +892,7 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
     if (mv_index < num_of_moves) {
       mv_index++;   // moves tried
     }
-    update_best_move_history(p, best_move_index, move_list, mv_index);
+    update_best_move_history(mo, p, best_move_index, move_list, mv_index);
   }
   assert(abs(best_score) != -INF);
 
@@ -596,31 +909,42 @@ static score_t scout_search(position_t *p, score_t beta, int depth,
 
 // search principal variation
 static score_t searchPV(position_t *p, score_t alpha, score_t beta, int depth,
-                        int ply, move_t *pv, uint64_t *node_count) {
+                        int ply, move_t *pv, uint64_t *node_count, Abort *pAbort) {
   pv[0] = 0;
+  move_order_t *mo = worker_move_order();
 
   // check whether we should abort
   tics++;
   if ((tics & ABORT_CHECK_PERIOD) == 0) {
     if (milliseconds() >= timeout) {
-      abortf = true;
+      root_abort.abort();
       return 0;
     }
   }
+  // a cutoff in a brother subtree aborts us between time checks
+  if (pAbort->isAborted()) {
+    return 0;
+  }
 
   // get transposition table record if available
-  ttRec_t *rec = tt_hashtable_get(p->key);
+  ttRec_t rec;
   int hash_table_move = 0;
-  if (rec) {
-    hash_table_move = tt_move_of(rec);
+  if (tt_hashtable_get(p->key, &rec)) {
+    hash_table_move = tt_move_of(&rec);
   }
 
   score_t best_score = -INF;
-  score_t sps = eval(p, false) + HMB;  // stand pat (having-the-move) bonus
   bool quiescence = (depth <= 0);      // are we in quiescence?
+  if (quiescence) {
+    STAT_INC(stat_quiescence_nodes);
+  } else {
+    STAT_INC(stat_full_nodes);
+  }
   score_t orig_alpha = alpha;
 
   if (quiescence) {
+    // stand pat (having-the-move) bonus; outside the window a bound will do
+    score_t sps = eval_bounded(p, alpha - HMB, beta - HMB) + HMB;
     best_score = sps;
     if (best_score >= beta) {
       return best_score;
@@ -630,16 +954,17 @@ static score_t searchPV(position_t *p, score_t alpha, score_t beta, int depth,
     }
   }
 
-  position_t np;  // next position
+  undo_t undo;    // to take back the move made
   // hopefully, more than we will need
   sortable_move_t move_list[MAX_NUM_MOVES];
-  // number of moves in list
-  int num_of_moves = generate_all(p, move_list);
+  // number of moves in list; in quiescence, only those that may capture
+  int num_of_moves = quiescence ? generate_moves(p, move_list, LASER_MOVES) :
+                                  generate_all(p, move_list);
 
   color_t fctm = color_to_move_of(p);
   int pov = 1 - fctm*2;      // point of view = 1 for white, -1 for black
-  move_t killer_a = killer[ply][0];
-  move_t killer_b = killer[ply][1];
+  move_t killer_a = mo->killer[ply][0];
+  move_t killer_b = mo->killer[ply][1];
 
   // sort special moves to the front
   for (int mv_index = 0; mv_index < num_of_moves; mv_index++) {
@@ -659,35 +984,49 @@ static score_t searchPV(position_t *p, score_t alpha, score_t beta, int depth,
       square_t fs  = from_square(mv);
       int      ot  = ORIENTATION_MASK & (orientation_of(p->board[fs]) + ro);
       square_t ts  = to_square(mv);
-      set_sort_key(&move_list[mv_index], best_move_history[fctm][pce][ts][ot]);
+      set_sort_key(&move_list[mv_index], *history_of(mo, fctm, pce, ts, ot));
     }
   }
 
   move_t subpv[MAX_PLY_IN_SEARCH];
   score_t score;
 
-  bool sortme = true;
+  move_picker_t picker;
+  picker_init(&picker, move_list, num_of_moves);
   int legal_move_count = 0;
   int mv_index;  // used outside of the loop
   int best_move_index = 0;   // index of best move found
 
+  // moves from parallel_from on have been scouted in parallel against
+  // scout_alpha
+  int parallel_from = num_of_moves;
+  score_t scout_scores[MAX_NUM_MOVES];
+  score_t scout_alpha = alpha;
+  bool cutoff_found = false;
+
   for (mv_index = 0; mv_index < num_of_moves; mv_index++) {
     subpv[0] = 0;
 
-    // on the fly sorting
-    if (sortme) {
-      for (int j = mv_index + 1; j < num_of_moves; j++) {
-        if (move_list[j] > move_list[mv_index]) {
-          sortable_move_t tmp = move_list[j];
-          move_list[j] = move_list[mv_index];
-          move_list[mv_index] = tmp;
-        }
-      }
-      if (sort_key(move_list[mv_index]) == 0) {
-        sortme = false;
+    // Young Brothers Wait: the eldest brother has been searched, so scout
+    // all the younger ones in parallel and collect their scores below
+    if (THREADS > 1 && parallel_from == num_of_moves && legal_move_count > 0 &&
+        !quiescence && depth >= PARALLEL_DEPTH) {
+      picker_sort_rest(&picker, mv_index);
+      parallel_from = mv_index;
+      scout_alpha = alpha;
+      cutoff_found = scout_siblings(p, alpha + 1, beta, depth, ply, move_list,
+                                    mv_index, num_of_moves, legal_move_count,
+                                    false, scout_scores, node_count, pAbort);
+      if (pAbort->isAborted()) {
+        return 0;
       }
     }
+    if (mv_index >= parallel_from && cutoff_found &&
+        scout_scores[mv_index] == -INF) {
+      continue;   // not searched, a younger brother cuts off anyway
+    }
 
+    picker_pick(&picker, mv_index);
     move_t mv = get_move(move_list[mv_index]);
     if (TRACE_MOVES) {
       print_move_info(mv, ply);
@@ -697,22 +1036,25 @@ static score_t searchPV(position_t *p, score_t alpha, score_t beta, int depth,
     bool blunder = false;  // shoot our own piece
 
     (*node_count)++;
-    piece_t victim = make_move(p, &np, mv);  // make the move baby!
+    piece_t victim = make_move(p, mv, &undo);  // make the move baby!
     if (victim == KO) {
       continue;
     }
 
     if (is_game_over(victim, &score, pov, ply)) {
+      unmake_move(p, &undo);
       goto scored;
     }
 
     if (victim == 0 && quiescence) {
+      unmake_move(p, &undo);
       continue;   // ignore noncapture moves in quiescence
     }
-    if (color_of(np.victim) == fctm) {
+    if (color_of(p->victim) == fctm) {
       blunder = true;
     }
     if (quiescence && blunder) {
+      unmake_move(p, &undo);
       continue;  // ignore own piece captures in quiescence
     }
 
@@ -723,31 +1065,43 @@ static score_t searchPV(position_t *p, score_t alpha, score_t beta, int depth,
       ext = 1;  // extend captures
     }
 
-    if (is_repeated(&np, &score, ply)) {
+    if (is_repeated(p, &score, ply)) {
+      unmake_move(p, &undo);
       goto scored;
     }
 
     // first move?
     if (legal_move_count == 1 || quiescence) {
-      score = -searchPV(&np, -beta, -alpha, ext + depth - 1, ply + 1,
-                        subpv, node_count);
-      if (abortf) {
+      score = -searchPV(p, -beta, -alpha, ext + depth - 1, ply + 1,
+                        subpv, node_count, pAbort);
+      if (pAbort->isAborted()) {
+        unmake_move(p, &undo);
         return 0;
       }
     } else {
-      score = -scout_search(&np, -alpha, ext + depth - 1, ply + 1, 0,
-                            subpv, node_count);
-      if (abortf) {
-        return 0;
+      // a parallel scout is still good unless it failed high and alpha has
+      // risen since
+      if (mv_index >= parallel_from && scout_scores[mv_index] != -INF &&
+          (scout_scores[mv_index] <= scout_alpha || alpha == scout_alpha)) {
+        score = scout_scores[mv_index];
+      } else {
+        score = -scout_search(p, -alpha, ext + depth - 1, ply + 1, 0,
+                              subpv, node_count, pAbort);
+        if (pAbort->isAborted()) {
+          unmake_move(p, &undo);
+          return 0;
+        }
       }
       if (score > alpha) {
-        score = -searchPV(&np, -beta, -alpha, ext + depth - 1, ply + 1,
-                          subpv, node_count);
-        if (abortf) {
+        score = -searchPV(p, -beta, -alpha, ext + depth - 1, ply + 1,
+                          subpv, node_count, pAbort);
+        if (pAbort->isAborted()) {
+          unmake_move(p, &undo);
           return 0;
         }
       }
     }
+    unmake_move(p, &undo);
 
    scored:
     if (score > best_score) {
@@ -761,9 +1115,10 @@ static score_t searchPV(position_t *p, score_t alpha, score_t beta, int depth,
         alpha = score;
       }
       if (score >= beta) {
-        if (mv != killer[ply][0]) {
-          killer[ply][1] = killer[ply][0];
-          killer[ply][0] = mv;
+        STAT_CUTOFF(mv_index);
+        if (mv != mo->killer[ply][0]) {
+          mo->killer[ply][1] = mo->killer[ply][0];
+          mo->killer[ply][0] = mv;
         }
         break;
       }
@@ -774,7 +1129,7 @@ static score_t searchPV(position_t *p, score_t alpha, score_t beta, int depth,
     if (mv_index < num_of_moves) {
       mv_index++;   // moves tried
     }
-    update_best_move_history(p, best_move_index, move_list, mv_index);
+    update_best_move_history(mo, p, best_move_index, move_list, mv_index);
   }
   assert(abs(best_score) != -INF);
 
@@ -794,14 +1149,19 @@ static score_t searchPV(position_t *p, score_t alpha, score_t beta, int depth,
 
 score_t searchRoot(position_t *p, score_t alpha, score_t beta, int depth,
                    int ply, move_t *pv, uint64_t *node_count, FILE *OUT) {
+  Abort *pAbort = &root_abort;
 
   static int num_of_moves = 0;                     // number of moves in list
   // hopefully, more than we will need
   static sortable_move_t move_list[MAX_NUM_MOVES];
+  // each new best move is keyed above all the earlier ones, so the next
+  // iteration tries them latest first
+  static sort_key_t best_key = 0;
 
   if (depth == 1) {
     // we are at depth 1; generate all possible moves
     num_of_moves = generate_all(p, move_list);
+    best_key = 0;
     // shuffle the list of moves. IMP: Commenting out the following loop is a significant performance gain.
     for (int i = 0; i < num_of_moves; i++) {
       int r = myrand() % num_of_moves;
@@ -816,10 +1176,33 @@ score_t searchRoot(position_t *p, score_t alpha, score_t beta, int depth,
   color_t fctm = color_to_move_of(p);
   int pov = 1 - fctm * 2;  // pov = 1 for White, -1 for Black
 
-  position_t next_position;            // next position
+  undo_t undo;                         // to take back the move made
   score_t score;
 
+  // moves from parallel_from on have been scouted in parallel against
+  // scout_alpha
+  int parallel_from = num_of_moves;
+  score_t scout_scores[MAX_NUM_MOVES];
+  score_t scout_alpha = alpha;
+  move_picker_t picker;
+  picker_init(&picker, move_list, num_of_moves);
+
   for (int mv_index = 0; mv_index < num_of_moves; mv_index++) {
+    // Young Brothers Wait: the eldest brother has been searched, so scout
+    // all the younger ones in parallel and collect their scores below
+    if (THREADS > 1 && parallel_from == num_of_moves && best_score > -INF &&
+        depth >= PARALLEL_DEPTH) {
+      picker_sort_rest(&picker, mv_index);
+      parallel_from = mv_index;
+      scout_alpha = alpha;
+      scout_siblings(p, alpha + 1, beta, depth, ply, move_list, mv_index,
+                     num_of_moves, 0, false, scout_scores, node_count, pAbort);
+      if (pAbort->isAborted()) {
+        return 0;
+      }
+    }
+
+    picker_pick(&picker, mv_index);
     move_t mv = get_move(move_list[mv_index]);
 
     if (TRACE_MOVES) {
@@ -827,38 +1210,51 @@ score_t searchRoot(position_t *p, score_t alpha, score_t beta, int depth,
     }
 
     (*node_count)++;
-    piece_t x = make_move(p, &next_position, mv);  // make the move baby!
+    piece_t x = make_move(p, mv, &undo);  // make the move baby!
     if (x == KO) {
       continue;  // not a legal move
     }
 
-    if ((is_game_over(x, &score, pov, ply)) || (is_repeated(&next_position, &score, ply))) {
+    if ((is_game_over(x, &score, pov, ply)) || (is_repeated(p, &score, ply))) {
+      unmake_move(p, &undo);
       subpv[0] = 0;
       goto scored;
     }
 
     // first move?
     if (mv_index == 0 || depth == 1) {
-      score = -searchPV(&next_position, -beta, -alpha, depth - 1, ply + 1,
-                        subpv, node_count);
-      if (abortf) {
+      score = -searchPV(p, -beta, -alpha, depth - 1, ply + 1,
+                        subpv, node_count, pAbort);
+      if (pAbort->isAborted()) {
+        unmake_move(p, &undo);
         return 0;
       }
     } else {
-      score = -scout_search(&next_position, -alpha, depth - 1, ply + 1, 0,
-                            subpv, node_count);
-      if (abortf) {
-        return 0;
+      // a parallel scout is still good unless it failed high and alpha has
+      // risen since
+      if (mv_index >= parallel_from && scout_scores[mv_index] != -INF &&
+          (scout_scores[mv_index] <= scout_alpha || alpha == scout_alpha)) {
+        score = scout_scores[mv_index];
+        subpv[0] = 0;
+      } else {
+        score = -scout_search(p, -alpha, depth - 1, ply + 1, 0,
+                              subpv, node_count, pAbort);
+        if (pAbort->isAborted()) {
+          unmake_move(p, &undo);
+          return 0;
+        }
       }
 
       if (score > alpha) {
-        score = -searchPV(&next_position, -beta, -alpha, depth - 1, ply + 1,
-                          subpv, node_count);
-        if (abortf) {
+        score = -searchPV(p, -beta, -alpha, depth - 1, ply + 1,
+                          subpv, node_count, pAbort);
+        if (pAbort->isAborted()) {
+          unmake_move(p, &undo);
           return 0;
         }
       }
     }
+    unmake_move(p, &undo);
 
   scored:
     if (score > best_score) {
@@ -882,12 +1278,9 @@ score_t searchRoot(position_t *p, score_t alpha, score_t beta, int depth,
       fprintf(OUT, "info score cp %d pv %s\n", score, pvbuf);
 
       // -------------------------------------------------------------------
-      // slide best move into front of list
-      // ----------------------------------
-      for (int j = mv_index; j > 0; j--) {
-        move_list[j] = move_list[j - 1];
-      }
-      move_list[0] = mv;
+      // key best move to the front of the list for the next iteration
+      // -------------------------------------------------------------
+      set_sort_key(&move_list[mv_index], ++best_key);
     }
 
     if (score > alpha) {
@@ -36,12 +36,16 @@
 #define MAX_SCORE_VAL INT16_MAX
 typedef int16_t score_t;  // Search uses "low res" values
 
+#define MAX_THREADS 64   // most Cilk workers the search keeps tables for
+
 void init_killer();
 void init_tics();
+void init_threads(int num_threads);
 void init_abort_timer(double goal_time);
 double elapsed_time();
 bool should_abort();
 void reset_abort();
+void abort_search();
 
 void init_best_move_history();
 move_t get_move(sortable_move_t sortable_mv);
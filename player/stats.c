@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2012 MIT License by 6.172 Staff
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ **/
+
+#include "stats.h"
+
+#ifdef STATS
+
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+
+#include "abort.hpp"
+
+stat_t stat_tt_probes;
+stat_t stat_tt_hits;
+stat_t stat_tt_cutoffs[2];
+stat_t stat_ko;
+stat_t stat_futility_prunes;
+stat_t stat_nmm_prunes;
+stat_t stat_lmr_researches;
+stat_t stat_full_nodes;
+stat_t stat_quiescence_nodes;
+stat_t stat_evals;
+stat_t stat_full_evals;
+stat_t stat_cutoffs_at[STATS_CUTOFF_SLOTS];
+
+void stats_reset() {
+  stat_tt_probes.set_value(0);
+  stat_tt_hits.set_value(0);
+  for (int i = 0; i < 2; i++) {
+    stat_tt_cutoffs[i].set_value(0);
+  }
+  stat_ko.set_value(0);
+  stat_futility_prunes.set_value(0);
+  stat_nmm_prunes.set_value(0);
+  stat_lmr_researches.set_value(0);
+  stat_full_nodes.set_value(0);
+  stat_quiescence_nodes.set_value(0);
+  stat_evals.set_value(0);
+  stat_full_evals.set_value(0);
+  for (int i = 0; i < STATS_CUTOFF_SLOTS; i++) {
+    stat_cutoffs_at[i].set_value(0);
+  }
+  abort_count.set_value(0);
+  poll_count.set_value(0);
+}
+
+void stats_print(FILE *out) {
+  fprintf(out, "info string stats nodes full %" PRIu64 " quiescence %" PRIu64
+          " evals %" PRIu64 " full_evals %" PRIu64 "\n",
+          stat_full_nodes.get_value(), stat_quiescence_nodes.get_value(),
+          stat_evals.get_value(), stat_full_evals.get_value());
+  // indexed by ttBound_t: UPPER, LOWER
+  fprintf(out, "info string stats tt probes %" PRIu64 " hits %" PRIu64
+          " cutoffs upper %" PRIu64 " lower %" PRIu64 "\n",
+          stat_tt_probes.get_value(), stat_tt_hits.get_value(),
+          stat_tt_cutoffs[0].get_value(), stat_tt_cutoffs[1].get_value());
+  fprintf(out, "info string stats prunes futility %" PRIu64 " nmm %" PRIu64
+          " lmr_researches %" PRIu64 " ko %" PRIu64 " aborts %u polls %u\n",
+          stat_futility_prunes.get_value(), stat_nmm_prunes.get_value(),
+          stat_lmr_researches.get_value(), stat_ko.get_value(),
+          abort_count.get_value(), poll_count.get_value());
+  fprintf(out, "info string stats cutoffs_at");
+  for (int i = 0; i < STATS_CUTOFF_SLOTS; i++) {
+    fprintf(out, " %" PRIu64, stat_cutoffs_at[i].get_value());
+  }
+  fprintf(out, "\n");
+}
+
+#endif  // STATS
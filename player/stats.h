@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2012 MIT License by 6.172 Staff
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ **/
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Search statistics, for tuning the pruning and reduction options.  They
+// are compiled in only when STATS is defined (make STATS=1); otherwise
+// STAT_INC and STAT_CUTOFF expand to nothing and the dump does nothing.
+// The counters are reducers, so that Cilk workers never contend for them.
+
+// cutoffs at move index STATS_CUTOFF_SLOTS - 1 and later share the last slot
+#define STATS_CUTOFF_SLOTS 16
+
+#ifdef STATS
+
+#include <cilk/cilk.h>
+#include <cilk/reducer_opadd.h>
+
+typedef cilk::reducer_opadd<uint64_t> stat_t;
+
+extern stat_t stat_tt_probes;
+extern stat_t stat_tt_hits;
+// by ttBound_t of the record, UPPER or LOWER; tt_is_usable never cuts on
+// an EXACT one
+extern stat_t stat_tt_cutoffs[2];
+extern stat_t stat_ko;                 // moves make_move rejected by Ko
+extern stat_t stat_futility_prunes;    // nodes searched as quiescence instead
+extern stat_t stat_nmm_prunes;
+extern stat_t stat_lmr_researches;     // reduced searches that failed high
+extern stat_t stat_full_nodes;
+extern stat_t stat_quiescence_nodes;
+extern stat_t stat_evals;              // eval_bounded and eval_cached calls
+extern stat_t stat_full_evals;         // those of them that traced the lasers
+extern stat_t stat_cutoffs_at[STATS_CUTOFF_SLOTS];
+
+#define STAT_INC(counter) ((counter) += 1)
+#define STAT_CUTOFF(index) \
+  STAT_INC(stat_cutoffs_at[(index) < STATS_CUTOFF_SLOTS ? (index) : \
+                           STATS_CUTOFF_SLOTS - 1])
+
+void stats_reset();
+// Prints the counts since the last stats_reset as "info string stats" lines.
+void stats_print(FILE *out);
+
+#else
+
+#define STAT_INC(counter)
+#define STAT_CUTOFF(index)
+
+static inline void stats_reset() {}
+static inline void stats_print(FILE *out) {}
+
+#endif  // STATS
+
+#endif  // STATS_H
@@ -24,63 +24,145 @@
 // transposition table stuff
 
 #include <assert.h>
+#include <pthread.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <sys/mman.h>
 
+#include <cilk/cilk.h>
+
+#include "stats.h"
 #include "tt.h"
 
 
 int HASH;     // hash table size in MBytes
+int HUGE_PAGES;  // Back the hash table with huge pages when possible.
 int USE_TT;   // Use the transposition table.
               // Turn off for deterministic behavior of the search.
 
-// the actual record that holds the data for the transposition
-// typedef to be ttRec_t in tt.h
-struct ttRec {
-  uint64_t  key;           //  64 bits
-  move_t    move;          //  32 bits
-  score_t   score;         //  16 bits
-  int       quality:8;     //   8 bits
-  ttBound_t bound:2;       //   2 bits
-  int       age:6;         //   6 bits
-                           //--------
-};                         // 128 bits total
-
-// each set is a 4-way set-associative cache and contains 4 records
-#define RECORDS_PER_SET 4
-typedef struct {
+// The table is shared by all search threads without any locking.  A record
+// is a single 64-bit word, which the hardware reads and writes atomically,
+// so a thread always sees a whole record written by one put.  Only the top
+// KEY_DATA_BITS bits of the key are kept; the low bits are implied by the
+// set the record is in.
+//
+// layout of ttRec_t.data
+#define MOVE_DATA_SHIFT     0   // 20 bits
+#define SCORE_DATA_SHIFT   20   // 16 bits
+#define SCORE_DATA_MASK    0xFFFF
+#define QUALITY_DATA_SHIFT 36   //  8 bits
+#define QUALITY_DATA_MASK  0xFF
+#define BOUND_DATA_SHIFT   44   //  2 bits
+#define BOUND_DATA_MASK    3
+#define AGE_DATA_SHIFT     46   //  2 bits
+#define AGE_DATA_MASK      3
+#define KEY_DATA_SHIFT     48   // 16 bits
+#define KEY_DATA_BITS      16
+                                //--------
+                                // 64 bits used
+
+// each set is an 8-way set-associative cache filling one cache line
+#define RECORDS_PER_SET 8
+struct ttSet {
   ttRec_t records[RECORDS_PER_SET];
-} ttSet_t;
+} CACHE_LINE_ALIGNMENT;
 
+struct ttHashtable hashtable;  // name of the global transposition table
 
-// struct def for the global transposition table
-struct ttHashtable {
-  uint64_t num_of_sets;    // how many sets in the hashtable
-  uint64_t mask;           // a mask to map from key to set index
-  unsigned age;
-  ttSet_t *tt_set;         // array of sets that contains the transposition
-} hashtable;  // name of the global transposition table
 
+static inline uint64_t key_fragment(uint64_t key) {
+  return key >> (64 - KEY_DATA_BITS);
+}
+
+static inline uint64_t pack_data(uint64_t key, move_t move, score_t score,
+                                 int quality, int bound, unsigned age) {
+  return ((uint64_t) (move & MOVE_MASK) << MOVE_DATA_SHIFT) |
+         ((uint64_t) (score & SCORE_DATA_MASK) << SCORE_DATA_SHIFT) |
+         ((uint64_t) (quality & QUALITY_DATA_MASK) << QUALITY_DATA_SHIFT) |
+         ((uint64_t) (bound & BOUND_DATA_MASK) << BOUND_DATA_SHIFT) |
+         ((uint64_t) (age & AGE_DATA_MASK) << AGE_DATA_SHIFT) |
+         (key_fragment(key) << KEY_DATA_SHIFT);
+}
 
 // getting the move out of the record
 move_t tt_move_of(ttRec_t *rec) {
-  return rec->move;
+  return (rec->data >> MOVE_DATA_SHIFT) & MOVE_MASK;
 }
 
 // getting the score out of the record
 score_t tt_score_of(ttRec_t *rec) {
-  return rec->score;
+  return (score_t) ((rec->data >> SCORE_DATA_SHIFT) & SCORE_DATA_MASK);
+}
+
+static inline int tt_quality_of(ttRec_t *rec) {
+  return (int8_t) ((rec->data >> QUALITY_DATA_SHIFT) & QUALITY_DATA_MASK);
+}
+
+static inline ttBound_t tt_bound_of(ttRec_t *rec) {
+  return (ttBound_t) ((rec->data >> BOUND_DATA_SHIFT) & BOUND_DATA_MASK);
+}
+
+static inline unsigned tt_age_of(ttRec_t *rec) {
+  return (rec->data >> AGE_DATA_SHIFT) & AGE_DATA_MASK;
+}
+
+// an empty slot is all zeros
+static inline bool tt_matches(ttRec_t *rec, uint64_t key) {
+  return rec->data != 0 &&
+         (rec->data >> KEY_DATA_SHIFT) == key_fragment(key);
+}
+
+// take a private copy of a record that other threads may be writing
+static inline void tt_load(volatile ttRec_t *slot, ttRec_t *rec) {
+  rec->data = slot->data;
+}
+
+static inline void tt_store(volatile ttRec_t *slot, uint64_t data) {
+  slot->data = data;
 }
 
 size_t tt_get_bytes_per_record() {
   return sizeof(struct ttRec);
 }
 
-uint32_t tt_get_num_of_records() {
+uint64_t tt_get_num_of_records() {
   return hashtable.num_of_sets * RECORDS_PER_SET;
 }
 
+#define HUGE_PAGE_SIZE (2ULL << 20)
+
+// Maps bytes of zeroed memory for the table, page aligned and so cache line
+// aligned too.  With HUGE_PAGES, explicit huge pages are tried first, then
+// transparent huge pages, so that probes into a large table do not miss in
+// the TLB.  Returns NULL on failure.
+static void *tt_alloc(size_t bytes) {
+  void *mem = MAP_FAILED;
+
+  bytes = (bytes + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+#ifdef MAP_HUGETLB
+  if (HUGE_PAGES) {
+    mem = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  }
+#endif
+  if (mem == MAP_FAILED) {
+    mem = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+      return NULL;
+    }
+#ifdef MADV_HUGEPAGE
+    if (HUGE_PAGES) {
+      madvise(mem, bytes, MADV_HUGEPAGE);
+    }
+#endif
+  }
+  hashtable.bytes = bytes;
+  return mem;
+}
+
 void tt_resize_hashtable(int size_in_meg) {
+  assert(sizeof(ttSet_t) == TT_SET_BYTES);
   uint64_t size_in_bytes = (uint64_t) size_in_meg * (1ULL << 20);
   // total number of sets we could have in the hashtable
   uint64_t num_of_sets = size_in_bytes / sizeof(ttSet_t);
@@ -99,16 +181,17 @@ void tt_resize_hashtable(int size_in_meg) {
   hashtable.mask = num_of_sets - 1;
   hashtable.age = 0;
 
-  free(hashtable.tt_set);  // free the old ones
-  hashtable.tt_set = (ttSet_t *) malloc(sizeof(ttSet_t) * num_of_sets);
+  tt_free_hashtable();  // free the old ones
+  hashtable.tt_set = (ttSet_t *) tt_alloc(sizeof(ttSet_t) * num_of_sets);
 
   if (hashtable.tt_set == NULL) {
     fprintf(stderr,  "Hash table too big\n");
     exit(1);
   }
 
-  // might as well clear the table while we are at it
-  memset(hashtable.tt_set, 0, sizeof(ttSet_t) * hashtable.num_of_sets);
+  // the mapping comes back zeroed, but clearing it in parallel is what
+  // first touches the pages, spreading them over the threads' NUMA nodes
+  tt_clear_hashtable();
 }
 
 void tt_make_hashtable(int size_in_meg) {
@@ -117,8 +200,11 @@ void tt_make_hashtable(int size_in_meg) {
 }
 
 void tt_free_hashtable() {
-  free(hashtable.tt_set);
+  if (hashtable.tt_set != NULL) {
+    munmap(hashtable.tt_set, hashtable.bytes);
+  }
   hashtable.tt_set = NULL;
+  hashtable.bytes = 0;
 }
 
 // age the hash table by incrementing global age
@@ -126,8 +212,21 @@ void tt_age_hashtable() {
   hashtable.age++;
 }
 
+// The table is cleared in chunks by all workers, so that each page is first
+// touched, and hence placed, by one of the threads that will probe it.
+#define CLEAR_CHUNK_SETS (1 << 15)   // 2 MB, one huge page
+
 void tt_clear_hashtable() {
-  memset(hashtable.tt_set, 0, sizeof(ttSet_t) * hashtable.num_of_sets);
+  uint64_t num_of_chunks =
+      (hashtable.num_of_sets + CLEAR_CHUNK_SETS - 1) / CLEAR_CHUNK_SETS;
+  cilk_for (uint64_t c = 0; c < num_of_chunks; c++) {
+    uint64_t first = c * CLEAR_CHUNK_SETS;
+    uint64_t count = hashtable.num_of_sets - first;
+    if (count > CLEAR_CHUNK_SETS) {
+      count = CLEAR_CHUNK_SETS;
+    }
+    memset(&hashtable.tt_set[first], 0, sizeof(ttSet_t) * count);
+  }
   hashtable.age = 0;
 }
 
@@ -137,68 +236,69 @@ void tt_hashtable_put(uint64_t key, int depth, score_t score,
   assert(abs(score) != INF);
 
   uint64_t set_index = key & hashtable.mask;
+  unsigned age = hashtable.age & AGE_DATA_MASK;
   // current record that we are looking into
-  ttRec_t *curr_rec = hashtable.tt_set[set_index].records;
+  volatile ttRec_t *curr_rec = hashtable.tt_set[set_index].records;
   // best record to replace that we found so far
-  ttRec_t *rec_to_replace = curr_rec;
+  volatile ttRec_t *rec_to_replace = curr_rec;
   int replacemt_val = -99;            // value of doing the replacement
+  int replacemt_quality = 0;          // quality of rec_to_replace
 
   move = move & MOVE_MASK;
 
   for (int i = 0; i < RECORDS_PER_SET; i++, curr_rec++) {
     int value = 0;  // points for sorting
+    ttRec_t rec;
+    tt_load(curr_rec, &rec);
 
     // always use entry if it's not used or has same key
-    if (!curr_rec->key || key == curr_rec->key) {
+    if (rec.data == 0 || tt_matches(&rec, key)) {
       if (move == 0) {
-        move = curr_rec->move;
+        move = tt_move_of(&rec);
       }
-      curr_rec->key = key;
-      curr_rec->quality = depth;
-      curr_rec->move = move;
-      curr_rec->age = hashtable.age;
-      curr_rec->score = score;
-      curr_rec->bound = (ttBound_t) bound_type;
-
+      tt_store(curr_rec, pack_data(key, move, score, depth, bound_type, age));
       return;
     }
 
+    if (i == 0) {
+      replacemt_quality = tt_quality_of(&rec);
+    }
     // otherwise, potential candidate for replacement
-    if (curr_rec->age == hashtable.age) {
+    if (tt_age_of(&rec) == age) {
       value -= 6;   // prefer not to replace if same age
     }
-    if (curr_rec->quality < rec_to_replace->quality) {
+    if (tt_quality_of(&rec) < replacemt_quality) {
       value += 1;   // prefer to replace if worse quality
     }
     if (value > replacemt_val) {
       replacemt_val = value;
       rec_to_replace = curr_rec;
+      replacemt_quality = tt_quality_of(&rec);
     }
   }
   // update the record that we are replacing with this record
-  rec_to_replace->key = key;
-  rec_to_replace->quality = depth;
-  rec_to_replace->move = move;
-  rec_to_replace->age = hashtable.age;
-  rec_to_replace->score = score;
-  rec_to_replace->bound = (ttBound_t) bound_type;
+  tt_store(rec_to_replace, pack_data(key, move, score, depth, bound_type, age));
 }
 
 
-ttRec_t *tt_hashtable_get(uint64_t key) { // FINAL OPTIMIZATION: consider inlining by appending file to search.c
+// copies the record for key into *rec; returns false if there is none
+bool tt_hashtable_get(uint64_t key, ttRec_t *rec) { // FINAL OPTIMIZATION: consider inlining by appending file to search.c
   if (!USE_TT) {
-    return NULL;  // done if we are not using the transposition table
+    return false;  // done if we are not using the transposition table
   }
 
+  STAT_INC(stat_tt_probes);
   uint64_t set_index = key & hashtable.mask;
-  ttRec_t *rec = hashtable.tt_set[set_index].records;
+  volatile ttRec_t *curr_rec = hashtable.tt_set[set_index].records;
 
-  for (int i = 0; i < RECORDS_PER_SET; i++, rec++) {
-    if (rec->key == key) {  // found the record that we are looking for
-      return rec;
+  for (int i = 0; i < RECORDS_PER_SET; i++, curr_rec++) {
+    tt_load(curr_rec, rec);
+    if (tt_matches(rec, key)) {  // found the record that we are looking for
+      STAT_INC(stat_tt_hits);
+      return true;
     }
   }
-  return NULL;
+  return false;
 }
 
 
@@ -215,7 +315,7 @@ score_t lose_in(int ply) {
 // when you retrieve the score from the hashtable, however, you want to
 // consider the value of the position based on where you are in the search tree
 score_t tt_adjust_score_from_hashtable(ttRec_t *rec, int ply_in_search) {
-  score_t score = rec->score;
+  score_t score = tt_score_of(rec);
   if (score >= win_in(MAX_PLY_IN_SEARCH)) {
     return score - ply_in_search;
   }
@@ -241,16 +341,160 @@ score_t tt_adjust_score_for_hashtable(score_t score, int ply_in_search) {
 bool tt_is_usable(ttRec_t *tt, int depth, score_t beta) {
   // can't use this record if we are searching at depth higher than the
   // depth of this record.
-  if (tt->quality < depth) {
+  if (tt_quality_of(tt) < depth) {
     return false;
   }
   // otherwise check whether the score falls within the bounds
-  if ((tt->bound == LOWER) && tt->score >= beta) {
+  if ((tt_bound_of(tt) == LOWER) && tt_score_of(tt) >= beta) {
+    STAT_INC(stat_tt_cutoffs[LOWER]);
     return true;
   }
-  if ((tt->bound == UPPER) && tt->score < beta) {
+  if ((tt_bound_of(tt) == UPPER) && tt_score_of(tt) < beta) {
+    STAT_INC(stat_tt_cutoffs[UPPER]);
     return true;
   }
 
   return false;
 }
+
+
+// ----------------------------------------------------------------------
+// Microbenchmark for tt_prefetch
+
+// Probes iterations random keys, making and taking back a move on p between
+// choosing each key and probing it, as the search does between a child's key and its
+// probe.  Runs once without and once with tt_prefetch on the key before the
+// move, and prints the time per probe of each.
+void tt_prefetch_bench(position_t *p, int iterations) {
+  sortable_move_t move_list[MAX_NUM_MOVES];
+  int num_of_moves = generate_all(p, move_list);
+  int save_use_tt = USE_TT;
+  uint64_t seed = 0x2545F4914F6CDD1DULL;
+
+  USE_TT = 1;
+  for (int pf = 0; pf < 2; pf++) {
+    double start = milliseconds();
+    for (int i = 0; i < iterations; i++) {
+      seed ^= seed << 13;
+      seed ^= seed >> 7;
+      seed ^= seed << 17;
+      uint64_t key = seed;
+      if (pf) {
+        tt_prefetch(key);
+      }
+      undo_t undo;
+      if (make_move(p, get_move(move_list[i % num_of_moves]), &undo) != KO) {
+        unmake_move(p, &undo);
+      }
+      ttRec_t rec;
+      tt_hashtable_get(key, &rec);
+    }
+    double elapsed = milliseconds() - start;
+    printf("info string tt probe %s prefetch: %.1f ns per probe\n",
+           pf ? "with" : "without", elapsed * 1e6 / iterations);
+  }
+  USE_TT = save_use_tt;
+}
+
+
+// ----------------------------------------------------------------------
+// Stress test for the lockless table
+
+#define STRESS_SETS 64      // sets hammered, to force contention
+#define STRESS_KEYS 1024    // distinct keys stored into them
+
+typedef struct {
+  uint64_t seed;        // private random number generator state
+  int      iterations;  // puts and gets to do
+  uint64_t hits;        // records found
+  uint64_t torn;        // records found whose contents do not match the key
+} stress_arg_t;
+
+// xorshift, since myrand() is not thread-safe; its low bits are weak, so
+// callers use the high bits
+static inline uint64_t stress_rand(uint64_t *state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 7;
+  *state ^= *state << 17;
+  return *state;
+}
+
+// Every put of a key stores the same contents, derived from the key, so a
+// record mixing two different puts shows up as a mismatch.
+static void stress_contents(uint64_t key, int *depth, score_t *score,
+                            int *bound, move_t *move) {
+  uint64_t h = key * 0x9E3779B97F4A7C15ULL;
+  *depth = (int) ((h >> 8) & 0x7F);
+  *score = (score_t) ((int) ((h >> 16) % 32000) - 16000);
+  *bound = (int) ((h >> 40) % 3);
+  *move = (move_t) ((h >> 42) & MOVE_MASK) | 1;   // never the null move 0
+}
+
+static void *stress_thread(void *arg) {
+  stress_arg_t *sa = (stress_arg_t *) arg;
+
+  for (int i = 0; i < sa->iterations; i++) {
+    // pick one of STRESS_KEYS keys, whose low bits map it to one of the
+    // STRESS_SETS sets
+    uint64_t k = (stress_rand(&sa->seed) >> 32) % STRESS_KEYS;
+    uint64_t key = ((k + 1) << (64 - KEY_DATA_BITS)) | (k % STRESS_SETS);
+    int depth, bound;
+    score_t score;
+    move_t move;
+    stress_contents(key, &depth, &score, &bound, &move);
+
+    if (stress_rand(&sa->seed) >> 63) {
+      tt_hashtable_put(key, depth, score, bound, move);
+    } else {
+      ttRec_t rec;
+      if (tt_hashtable_get(key, &rec)) {
+        sa->hits++;
+        if (tt_move_of(&rec) != move || tt_score_of(&rec) != score ||
+            tt_quality_of(&rec) != depth || tt_bound_of(&rec) != bound) {
+          sa->torn++;
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
+// Runs num_threads threads doing iterations random puts and gets each on a
+// few sets of a freshly cleared table.  Returns the number of torn records
+// seen, which must be 0.  The table is cleared again afterwards.
+uint64_t tt_stress_test(int num_threads, int iterations) {
+  pthread_t *threads = (pthread_t *) malloc(sizeof(pthread_t) * num_threads);
+  stress_arg_t *args = (stress_arg_t *) malloc(sizeof(stress_arg_t) * num_threads);
+  int save_use_tt = USE_TT;
+  uint64_t hits = 0;
+  uint64_t torn = 0;
+
+  USE_TT = 1;
+  tt_clear_hashtable();
+
+  for (int t = 0; t < num_threads; t++) {
+    args[t].seed = 0x2545F4914F6CDD1DULL * (t + 1);
+    args[t].iterations = iterations;
+    args[t].hits = 0;
+    args[t].torn = 0;
+    if (pthread_create(&threads[t], NULL, stress_thread, &args[t]) != 0) {
+      fprintf(stderr, "Could not create stress test thread\n");
+      exit(1);
+    }
+  }
+  for (int t = 0; t < num_threads; t++) {
+    pthread_join(threads[t], NULL);
+    hits += args[t].hits;
+    torn += args[t].torn;
+  }
+
+  printf("info string tt stress test: %d threads, %d operations each, "
+         "%" PRIu64 " hits, %" PRIu64 " torn\n",
+         num_threads, iterations, hits, torn);
+
+  tt_clear_hashtable();
+  USE_TT = save_use_tt;
+  free(threads);
+  free(args);
+  return torn;
+}
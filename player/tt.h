@@ -41,30 +41,65 @@ typedef enum {
   EXACT
 } ttBound_t;
 
-// Just forward declarations
-// The real definition is in tt.c
-typedef struct ttRec ttRec_t;
+// A transposition record.  The table is shared by all search threads
+// without locks, so lookups hand out a private copy of the record, which
+// stays valid however the table changes afterwards.  The fields are
+// packed into one word and should only be read through the accessors in
+// tt.c.
+typedef struct ttRec {
+  uint64_t  data;   // packed move, score, quality, bound, age and key bits
+} ttRec_t;
+
+// A set of records sharing one cache line; its layout is private to tt.c.
+#define TT_SET_BYTES 64
+typedef struct ttSet ttSet_t;
+
+// struct def for the global transposition table
+struct ttHashtable {
+  uint64_t num_of_sets;    // how many sets in the hashtable
+  uint64_t mask;           // a mask to map from key to set index
+  unsigned age;
+  ttSet_t *tt_set;         // array of sets that contains the transposition
+  size_t   bytes;          // size of the mapping holding tt_set
+};
+extern struct ttHashtable hashtable;
+
+// Starts loading the set for key into the cache without waiting for it.
+// Called as soon as a child position's key is known, so that the miss
+// overlaps the rest of making the move and the child's eval instead of
+// stalling the child's probe.
+static inline void tt_prefetch(uint64_t key) {
+  __builtin_prefetch((char *) hashtable.tt_set +
+                     (key & hashtable.mask) * TT_SET_BYTES);
+}
 
 // accessor methods for accessing move and score recorded in ttRec_t
 move_t tt_move_of(ttRec_t *tt);
 score_t tt_score_of(ttRec_t *tt);
 
 size_t tt_get_bytes_per_record();
-uint32_t tt_get_num_of_records();
+uint64_t tt_get_num_of_records();
 
 // operations on the global hashtable
 void tt_make_hashtable(int sizeMeg);
 void tt_resize_hashtable(int sizeInMeg);
 void tt_free_hashtable();
+void tt_clear_hashtable();
 void tt_age_hashtable();
 
 // putting / getting transposition data into / from hashtable
 void tt_hashtable_put(uint64_t key, int depth, score_t score,
                       int type, move_t move);
-ttRec_t *tt_hashtable_get(uint64_t key);
+bool tt_hashtable_get(uint64_t key, ttRec_t *rec);
 
 score_t tt_adjust_score_from_hashtable(ttRec_t *rec, int ply);
 score_t tt_adjust_score_for_hashtable(score_t score, int ply);
 bool tt_is_usable(ttRec_t *tt, int depth, score_t beta);
 
+// time probes of random keys with and without tt_prefetch
+void tt_prefetch_bench(position_t *p, int iterations);
+
+// hammer the table from many threads, checking that no torn record is seen
+uint64_t tt_stress_test(int num_threads, int iterations);
+
 #endif  // TT_H
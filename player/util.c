@@ -49,16 +49,52 @@ double milliseconds() {
   return result;
 }
 
+// Seed variables of myrand
+static uint64_t x, y;
+static unsigned int z1, c1, z2, c2;
+static bool seeded = false;
+
+// Restarts myrand from its seed, so that what follows is reproducible.
+void reset_myrand() {
+  x = 123456789123ULL;
+  y = 987654321987ULL;
+  z1 = 43219876;
+  c1 = 6543217;
+  z2 = 21987643;
+  c2 = 1732654;
+}
+
+void get_myrand_state(myrand_state_t *s) {
+  s->x = x;
+  s->y = y;
+  s->z1 = z1;
+  s->c1 = c1;
+  s->z2 = z2;
+  s->c2 = c2;
+}
+
+// Puts myrand back where get_myrand_state found it.
+void set_myrand_state(const myrand_state_t *s) {
+  x = s->x;
+  y = s->y;
+  z1 = s->z1;
+  c1 = s->c1;
+  z2 = s->z2;
+  c2 = s->c2;
+  seeded = true;
+}
+
 // Public domain code for JLKISS64 RNG - long period KISS RNG producing
 // 64-bit results
 uint64_t myrand() {
   static int first_time = 0;
-  // Seed variables
-  static uint64_t x = 123456789123ULL, y = 987654321987ULL;
-  static unsigned int z1 = 43219876, c1 = 6543217, z2 = 21987643,
-                      c2 = 1732654;  // Seed variables
   static uint64_t t;
 
+  if (!seeded) {
+    reset_myrand();
+    seeded = true;
+  }
+
   if (first_time) {
     int  i;
     FILE *f = fopen("/dev/urandom", "r");
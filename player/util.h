@@ -45,5 +45,15 @@
 void debug_log(int log_level, const char *str, ...);
 double  milliseconds();
 uint64_t myrand();
+void reset_myrand();
+
+// Where myrand is in its sequence
+typedef struct {
+  uint64_t     x, y;
+  unsigned int z1, c1, z2, c2;
+} myrand_state_t;
+
+void get_myrand_state(myrand_state_t *s);
+void set_myrand_state(const myrand_state_t *s);
 
 #endif  // UTIL_H